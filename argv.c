@@ -0,0 +1,124 @@
+#include "shell.h"
+
+int argv_push(argv_t *av, char *s);
+size_t argv_size(char **v);
+size_t argv_limit(void);
+int argv_fits(char **args);
+char **argv_dup(char **v);
+
+/**
+ * argv_push - Appends a word to an argument vector.
+ * @av: The vector.
+ * @s: The malloc'd word, or NULL if allocating it failed. It is freed
+ *     if it cannot be added.
+ *
+ * Return: 0 on success, or -1 if memory ran out.
+ *
+ * Description: The vector doubles as it fills, so building it costs a
+ *              handful of copies whatever its final size, and keeps room
+ *              for the two terminating NULL entries.
+ */
+int argv_push(argv_t *av, char *s)
+{
+	size_t cap = av->cap ? av->cap * 2 : 16;
+	char **new;
+
+	if (!s)
+		return (-1);
+	if (av->n + 2 >= av->cap)
+	{
+		new = _realloc(av->v, sizeof(char *) * av->cap,
+			       sizeof(char *) * cap);
+		if (!new)
+		{
+			free(s);
+			return (-1);
+		}
+		av->v = new;
+		av->cap = cap;
+	}
+	av->v[av->n++] = s;
+	av->v[av->n] = av->v[av->n + 1] = NULL;
+	return (0);
+}
+
+/**
+ * argv_size - Measures the room an array of strings takes in the memory
+ *             execve copies it to.
+ * @v: The NULL-terminated array.
+ *
+ * Return: The bytes taken by the strings and the pointers to them.
+ */
+size_t argv_size(char **v)
+{
+	size_t size = sizeof(char *);
+
+	for (; v && *v; v++)
+		size += _strlen(*v) + 1 + sizeof(char *);
+	return (size);
+}
+
+/**
+ * argv_limit - Gets the room left for the arguments of a program.
+ *
+ * Return: ARG_MAX, less the environment and some slack, or 0.
+ */
+size_t argv_limit(void)
+{
+	long max = sysconf(_SC_ARG_MAX);
+	size_t env = argv_size(environ) + ARG_SLACK;
+
+	if (max <= 0)
+		max = _POSIX_ARG_MAX;
+	return ((size_t)max > env ? (size_t)max - env : 0);
+}
+
+/**
+ * argv_fits - Checks that arguments can be passed to a program.
+ * @args: The arguments.
+ *
+ * Return: 1 if they fit, or 0 if they do not, after printing an error.
+ *
+ * Description: Catching this before forking gives a clear message where
+ *              execve would fail with E2BIG in the child.
+ */
+int argv_fits(char **args)
+{
+	int i;
+
+	for (i = 0; args[i]; i++)
+	{
+		if (_strlen(args[i]) >= ARG_STRLEN_MAX)
+			break;
+	}
+	if (!args[i] && argv_size(args) <= argv_limit())
+		return (1);
+	print_error(ERR_ARG_MAX, args[0]);
+	return (0);
+}
+
+/**
+ * argv_dup - Copies an array of strings.
+ * @v: The NULL-terminated array, with at least one string.
+ *
+ * Return: The copy, terminated by two NULL entries the way free_args
+ *         expects, or NULL if memory ran out.
+ */
+char **argv_dup(char **v)
+{
+	argv_t av;
+	char *s;
+
+	_memset(&av, 0, sizeof(av));
+	for (; *v; v++)
+	{
+		s = malloc(_strlen(*v) + 1);
+		if (argv_push(&av, s ? _strcpy(s, *v) : NULL) == -1)
+		{
+			if (av.v)
+				free_args(av.v, av.v);
+			return (NULL);
+		}
+	}
+	return (av.v);
+}
@@ -0,0 +1,185 @@
+#include "shell.h"
+
+char *arith_expand(char *start, int *used, int *exe_ret);
+arith_t *arith_compile(char *text);
+int arith_name(arith_ps_t *ps);
+void arith_free(arith_t *a);
+void arith_cache_free(void);
+
+static arith_t *arith_cache[ARITH_SLOTS];
+
+/**
+ * arith_expand - Evaluates an arithmetic expansion.
+ * @start: The expansion, starting with "$((".
+ * @used: Where to store the length of the expansion, up to and including
+ *        the closing "))". The parentheses between must balance, and
+ *        a ')' right after the expansion closes nothing, as dash reports.
+ * @exe_ret: The return value of the last executed command, for $? inside
+ *           the expression.
+ *
+ * Return: If the expression is malformed or fails - NULL, after printing
+ *         an error.
+ *         Otherwise - the value as a malloc'd decimal string.
+ *
+ * Description: Parameters written with '$' inside the expression are
+ *              replaced first. The expression is then compiled once into
+ *              bytecode, which is cached by its text, so a loop that
+ *              evaluates "i + 1" on every pass parses it only once.
+ */
+char *arith_expand(char *start, int *used, int *exe_ret)
+{
+	arith_t **slot;
+	char *text, *value = NULL;
+	int i, depth = 0, closed;
+	long num;
+
+	for (i = 3; start[i] && (start[i] != ')' || depth); i++)
+		depth += (start[i] == '(') - (start[i] == ')');
+	closed = start[i] == ')' && start[i + 1] == ')';
+	*used = i + (start[i] != '\0') + closed;
+	text = malloc(i - 2);
+	if (!text)
+		return (NULL);
+	text[0] = '\0';
+	_strncat(text, start + 3, i - 3);
+	if (closed && _strchr(text, '$') &&
+	    variable_replacement(&text, exe_ret) == -1)
+	{
+		free(text);
+		return (NULL);
+	}
+	slot = closed ? &arith_cache[path_hash(text) % ARITH_SLOTS] : NULL;
+	if (slot && (!*slot || _strcmp((*slot)->text, text) != 0))
+	{
+		arith_free(*slot);
+		*slot = arith_compile(text);
+	}
+	if (!closed)
+		print_error(ERR_ARITH_CLOSE, "");
+	else if (start[*used] == ')')
+		print_error(ERR_SYNTAX, ")");
+	else if (!*slot)
+		print_error(ERR_ARITH, text);
+	else if (arith_exec(*slot, &num) == 0)
+	{
+		value = malloc(21);
+		if (value)
+			_itoa_buf(num, value);
+	}
+	free(text);
+	return (value);
+}
+
+/**
+ * arith_compile - Compiles an arithmetic expression into bytecode.
+ * @text: The expression.
+ *
+ * Return: If the expression is malformed - NULL.
+ *         Otherwise - the compiled expression.
+ *
+ * Description: No token emits more than eight longs of code and every
+ *              variable name is followed by some other character, which
+ *              bounds the buffers. The code is copied into a buffer of
+ *              its exact size at the end.
+ */
+arith_t *arith_compile(char *text)
+{
+	arith_ps_t ps;
+	arith_t *a = malloc(sizeof(arith_t));
+	int len = _strlen(text);
+	long *code;
+
+	if (!a)
+		return (NULL);
+	a->len = a->nnames = 0;
+	a->text = malloc(len + 1);
+	a->code = malloc(sizeof(long) * (8 * len + 8));
+	a->names = malloc(sizeof(char *) * (len / 2 + 1));
+	ps.p = text;
+	ps.depth = 0;
+	ps.cap = 8 * len + 8;
+	ps.a = a;
+	ps.err = !a->text || !a->code || !a->names;
+	if (!ps.err)
+	{
+		_strcpy(a->text, text);
+		arith_next(&ps);
+		if (ps.tok == AR_TOK_END)
+			arith_emit(&ps, AR_NUM, 0);
+		else
+			arith_comma(&ps);
+	}
+	code = ps.err ? NULL : malloc(sizeof(long) * (a->len + 1));
+	if (ps.err || ps.tok != AR_TOK_END || !code)
+	{
+		free(code);
+		arith_free(a);
+		return (NULL);
+	}
+	_memcpy(code, a->code, sizeof(long) * a->len);
+	free(a->code);
+	a->code = code;
+	return (a);
+}
+
+/**
+ * arith_name - Finds or adds the current name token in the variable table
+ *              of the expression being compiled.
+ * @ps: The compiler state.
+ *
+ * Return: The index of the variable.
+ */
+int arith_name(arith_ps_t *ps)
+{
+	arith_t *a = ps->a;
+	int i;
+
+	for (i = 0; i < a->nnames; i++)
+	{
+		if (_strncmp(a->names[i], ps->name, ps->nlen) == 0 &&
+		    a->names[i][ps->nlen] == '\0')
+			return (i);
+	}
+	a->names[i] = malloc(ps->nlen + 1);
+	if (!a->names[i])
+	{
+		ps->err = 1;
+		return (0);
+	}
+	a->names[i][0] = '\0';
+	_strncat(a->names[i], ps->name, ps->nlen);
+	a->nnames++;
+	return (i);
+}
+
+/**
+ * arith_free - Frees a compiled arithmetic expression.
+ * @a: The expression, or NULL.
+ */
+void arith_free(arith_t *a)
+{
+	int i;
+
+	if (!a)
+		return;
+	for (i = 0; a->names && i < a->nnames; i++)
+		free(a->names[i]);
+	free(a->names);
+	free(a->code);
+	free(a->text);
+	free(a);
+}
+
+/**
+ * arith_cache_free - Frees every cached arithmetic expression.
+ */
+void arith_cache_free(void)
+{
+	int i;
+
+	for (i = 0; i < ARITH_SLOTS; i++)
+	{
+		arith_free(arith_cache[i]);
+		arith_cache[i] = NULL;
+	}
+}
@@ -0,0 +1,183 @@
+#include "shell.h"
+
+void arith_next(arith_ps_t *ps);
+char *arith_num(char *s, long *num);
+int arith_binop(char *op, int len, int *prec);
+int arith_emit(arith_ps_t *ps, long op, long arg);
+void arith_var(arith_ps_t *ps);
+
+/**
+ * arith_next - Reads the next token of an arithmetic expression.
+ * @ps: The compiler state. Its token fields are updated.
+ *
+ * Description: Operators are matched longest first. Anything that is not
+ *              a number, a name or an operator marks the expression as
+ *              invalid.
+ */
+void arith_next(arith_ps_t *ps)
+{
+	static char *ops[] = { "<<=", ">>=", "<<", ">>", "<=", ">=", "==",
+		"!=", "&&", "||", "++", "--", "*=", "/=", "%=", "+=", "-=",
+		"&=", "^=", "|=", "*", "/", "%", "+", "-", "<", ">", "&", "^",
+		"|", "!", "~", "?", ":", "=", "(", ")", ",", NULL };
+	char *p = ps->p;
+	int i;
+
+	while (*p == ' ' || *p == '\t' || *p == '\n')
+		p++;
+	ps->tok = *p ? AR_TOK_OP : AR_TOK_END;
+	if (*p >= '0' && *p <= '9')
+	{
+		ps->tok = AR_TOK_NUM;
+		p = arith_num(p, &ps->num);
+		ps->err |= p == NULL;
+	}
+	else if (*p == '_' || ((*p | 32) >= 'a' && (*p | 32) <= 'z'))
+	{
+		ps->tok = AR_TOK_NAME;
+		for (ps->name = p; *p == '_' || (*p >= '0' && *p <= '9') ||
+		     ((*p | 32) >= 'a' && (*p | 32) <= 'z'); p++)
+			;
+		ps->nlen = p - ps->name;
+	}
+	for (i = 0; ps->tok == AR_TOK_OP && ops[i]; i++)
+	{
+		if (_strncmp(p, ops[i], _strlen(ops[i])) == 0)
+		{
+			ps->op = ops[i];
+			p += _strlen(ops[i]);
+			break;
+		}
+	}
+	ps->err |= ps->tok == AR_TOK_OP && !ops[i];
+	ps->p = p;
+}
+
+/**
+ * arith_num - Converts an integer constant.
+ * @s: The constant: decimal, octal with a leading 0 or hex with a
+ *     leading 0x.
+ * @num: Where to store the value. It wraps around at 64 bits.
+ *
+ * Return: If the constant is malformed - NULL.
+ *         Otherwise - a pointer just past it.
+ */
+char *arith_num(char *s, long *num)
+{
+	unsigned long v = 0;
+	int base = 10, d;
+	char *start;
+
+	if (*s == '0')
+		base = (s[1] == 'x' || s[1] == 'X') ? 16 : 8;
+	s += base == 16 ? 2 : 0;
+	for (start = s;; s++)
+	{
+		if (*s >= '0' && *s <= '9')
+			d = *s - '0';
+		else if ((*s | 32) >= 'a' && (*s | 32) <= 'f')
+			d = (*s | 32) - 'a' + 10;
+		else
+			break;
+		if (d >= base)
+			return (NULL);
+		v = v * base + d;
+	}
+	if (s == start || *s == '_' || ((*s | 32) >= 'a' && (*s | 32) <= 'z'))
+		return (NULL);
+	*num = v;
+	return (s);
+}
+
+/**
+ * arith_binop - Looks up a binary operator.
+ * @op: The operator text.
+ * @len: The length of the operator text.
+ * @prec: Where to store its precedence, higher binding tighter.
+ *
+ * Return: If op is not a binary operator - -1.
+ *         Otherwise - its index: the opcode minus AR_MUL, 16 for "&&" or
+ *         17 for "||".
+ */
+int arith_binop(char *op, int len, int *prec)
+{
+	static char *ops[] = { "*", "/", "%", "+", "-", "<<", ">>", "<", "<=",
+		">", ">=", "==", "!=", "&", "^", "|", "&&", "||", NULL };
+	static int precs[] = { 10, 10, 10, 9, 9, 8, 8, 7, 7, 7, 7, 6, 6, 5, 4,
+		3, 2, 1 };
+	int i;
+
+	for (i = 0; ops[i]; i++)
+	{
+		if (_strlen(ops[i]) == len && _strncmp(op, ops[i], len) == 0)
+		{
+			*prec = precs[i];
+			return (i);
+		}
+	}
+	return (-1);
+}
+
+/**
+ * arith_emit - Appends an instruction to the bytecode.
+ * @ps: The compiler state.
+ * @op: The AR_* opcode.
+ * @arg: The operand, for opcodes up to AR_JMP.
+ *
+ * Return: The index of the operand, for patching jumps later.
+ */
+int arith_emit(arith_ps_t *ps, long op, long arg)
+{
+	arith_t *a = ps->a;
+
+	if (a->len + 2 > ps->cap)
+	{
+		ps->err = 1;
+		return (0);
+	}
+	a->code[a->len++] = op;
+	if (op > AR_JMP)
+		return (a->len);
+	a->code[a->len] = arg;
+	return (a->len++);
+}
+
+/**
+ * arith_var - Compiles a variable, with an optional prefix or postfix
+ *             "++" or "--".
+ * @ps: The compiler state. The current token is the name or the prefix
+ *      operator. The token after the operand is read on return.
+ */
+void arith_var(arith_ps_t *ps)
+{
+	char *op = NULL;
+	int var, post = 0;
+
+	if (ps->tok == AR_TOK_OP)
+	{
+		op = ps->op;
+		arith_next(ps);
+	}
+	ps->err |= ps->tok != AR_TOK_NAME;
+	if (ps->err)
+		return;
+	var = arith_name(ps);
+	arith_next(ps);
+	if (!op && ps->tok == AR_TOK_OP && (_strcmp(ps->op, "++") == 0 ||
+					    _strcmp(ps->op, "--") == 0))
+	{
+		op = ps->op;
+		post = 1;
+		arith_next(ps);
+	}
+	arith_emit(ps, AR_VAR, var);
+	if (!op)
+		return;
+	if (post)
+		arith_emit(ps, AR_DUP, 0);
+	arith_emit(ps, AR_NUM, 1);
+	arith_emit(ps, op[0] == '+' ? AR_ADD : AR_SUB, 0);
+	arith_emit(ps, AR_STORE, var);
+	if (post)
+		arith_emit(ps, AR_POP, 0);
+}
@@ -0,0 +1,175 @@
+#include "shell.h"
+
+void arith_comma(arith_ps_t *ps);
+void arith_assign(arith_ps_t *ps);
+void arith_cond(arith_ps_t *ps);
+void arith_binary(arith_ps_t *ps, int min);
+void arith_unary(arith_ps_t *ps);
+
+/**
+ * arith_comma - Compiles expressions separated by commas. Only the value
+ *               of the last one is kept.
+ * @ps: The compiler state.
+ */
+void arith_comma(arith_ps_t *ps)
+{
+	arith_assign(ps);
+	while (!ps->err && ps->tok == AR_TOK_OP && _strcmp(ps->op, ",") == 0)
+	{
+		arith_emit(ps, AR_POP, 0);
+		arith_next(ps);
+		arith_assign(ps);
+	}
+}
+
+/**
+ * arith_assign - Compiles an assignment, "=" or a compound operator such
+ *                as "+=", or else a conditional expression.
+ * @ps: The compiler state.
+ *
+ * Description: Assignments group right to left. A name is only an
+ *              assignment target if an assignment operator follows it,
+ *              so the state is rewound otherwise.
+ */
+void arith_assign(arith_ps_t *ps)
+{
+	arith_ps_t save = *ps;
+	int var = 0, op = 0, prec, len = 0;
+
+	if (ps->tok == AR_TOK_NAME)
+	{
+		var = arith_name(ps);
+		arith_next(ps);
+		if (ps->tok == AR_TOK_OP)
+			len = _strlen(ps->op);
+		if (!len || ps->op[len - 1] != '=' ||
+		    (len == 2 && !_strchr("*/%+-&^|", ps->op[0])))
+			len = 0;
+	}
+	if (!len)
+	{
+		*ps = save;
+		arith_cond(ps);
+		return;
+	}
+	if (++ps->depth > ARITH_DEPTH)
+	{
+		ps->err = 1;
+		return;
+	}
+	if (len > 1)
+	{
+		arith_emit(ps, AR_VAR, var);
+		op = arith_binop(ps->op, len - 1, &prec);
+	}
+	arith_next(ps);
+	arith_assign(ps);
+	if (len > 1)
+		arith_emit(ps, AR_MUL + op, 0);
+	arith_emit(ps, AR_STORE, var);
+	ps->depth--;
+}
+
+/**
+ * arith_cond - Compiles a conditional expression (c ? a : b), or else a
+ *              binary expression.
+ * @ps: The compiler state.
+ */
+void arith_cond(arith_ps_t *ps)
+{
+	int jz, jmp;
+
+	arith_binary(ps, 1);
+	if (ps->err || ps->tok != AR_TOK_OP || _strcmp(ps->op, "?") != 0)
+		return;
+	jz = arith_emit(ps, AR_JZ, 0);
+	arith_next(ps);
+	arith_comma(ps);
+	if (ps->err || ps->tok != AR_TOK_OP || _strcmp(ps->op, ":") != 0)
+	{
+		ps->err = 1;
+		return;
+	}
+	jmp = arith_emit(ps, AR_JMP, 0);
+	ps->a->code[jz] = ps->a->len;
+	arith_next(ps);
+	arith_assign(ps);
+	ps->a->code[jmp] = ps->a->len;
+}
+
+/**
+ * arith_binary - Compiles binary operators by precedence climbing.
+ * @ps: The compiler state.
+ * @min: The lowest precedence that may be consumed at this level.
+ *
+ * Description: "&&" and "||" jump over their right operand when the left
+ *              one decides the result, and yield 0 or 1.
+ */
+void arith_binary(arith_ps_t *ps, int min)
+{
+	int i, prec, skip, end;
+
+	arith_unary(ps);
+	while (!ps->err && ps->tok == AR_TOK_OP)
+	{
+		i = arith_binop(ps->op, _strlen(ps->op), &prec);
+		if (i < 0 || prec < min)
+			return;
+		arith_next(ps);
+		if (i < 16)
+		{
+			arith_binary(ps, prec + 1);
+			arith_emit(ps, AR_MUL + i, 0);
+			continue;
+		}
+		skip = arith_emit(ps, i == 16 ? AR_JZ : AR_JNZ, 0);
+		arith_binary(ps, prec + 1);
+		arith_emit(ps, AR_BOOL, 0);
+		end = arith_emit(ps, AR_JMP, 0);
+		ps->a->code[skip] = ps->a->len;
+		arith_emit(ps, AR_NUM, i == 17);
+		ps->a->code[end] = ps->a->len;
+	}
+}
+
+/**
+ * arith_unary - Compiles a number, a variable, a parenthesized
+ *               expression or a prefix operator applied to one of these.
+ * @ps: The compiler state.
+ */
+void arith_unary(arith_ps_t *ps)
+{
+	char *op = ps->tok == AR_TOK_OP ? ps->op : "";
+	int next = 1;
+
+	if (ps->err || ++ps->depth > ARITH_DEPTH || ps->tok == AR_TOK_END)
+		ps->err = 1;
+	else if (ps->tok == AR_TOK_NUM)
+		arith_emit(ps, AR_NUM, ps->num);
+	else if (ps->tok == AR_TOK_NAME || _strcmp(op, "++") == 0 ||
+		 _strcmp(op, "--") == 0)
+	{
+		arith_var(ps);
+		next = 0;
+	}
+	else if (_strcmp(op, "(") == 0)
+	{
+		arith_next(ps);
+		arith_comma(ps);
+		ps->err |= ps->tok != AR_TOK_OP || _strcmp(ps->op, ")") != 0;
+	}
+	else if (_strchr("+-!~", op[0]) && !op[1])
+	{
+		arith_next(ps);
+		arith_unary(ps);
+		if (op[0] != '+')
+			arith_emit(ps, op[0] == '-' ? AR_NEG :
+				   op[0] == '!' ? AR_NOT : AR_BNOT, 0);
+		next = 0;
+	}
+	else
+		ps->err = 1;
+	ps->depth--;
+	if (!ps->err && next)
+		arith_next(ps);
+}
@@ -0,0 +1,170 @@
+#include "shell.h"
+
+int arith_exec(arith_t *a, long *result);
+long arith_op(long op, long x, long y, int *err);
+int arith_get(char *var, long *num);
+int arith_set(char *var, long num);
+
+/**
+ * arith_exec - Runs the bytecode of a compiled arithmetic expression.
+ * @a: The expression.
+ * @result: Where to store its value.
+ *
+ * Return: 0 on success, or 1 if evaluation failed (an error is printed).
+ */
+int arith_exec(arith_t *a, long *result)
+{
+	long st[ARITH_STACK], op, arg = 0;
+	int sp = 0, pc = 0, err = 0;
+
+	while (pc < a->len && !err)
+	{
+		op = a->code[pc++];
+		if (op <= AR_JMP)
+			arg = a->code[pc++];
+		if (sp >= ARITH_STACK)
+		{
+			print_error(ERR_ARITH, a->text);
+			return (1);
+		}
+		if (op == AR_NUM)
+			st[sp++] = arg;
+		else if (op == AR_VAR)
+			err = arith_get(a->names[arg], &st[sp++]);
+		else if (op == AR_STORE)
+			err = arith_set(a->names[arg], st[sp - 1]);
+		else if (op == AR_JZ || op == AR_JNZ)
+			pc = (st[--sp] != 0) == (op == AR_JNZ) ? arg : pc;
+		else if (op == AR_JMP)
+			pc = arg;
+		else if (op == AR_POP)
+			sp--;
+		else if (op == AR_DUP)
+		{
+			st[sp] = st[sp - 1];
+			sp++;
+		}
+		else if (op < AR_MUL)
+			st[sp - 1] = arith_op(op, 0, st[sp - 1], &err);
+		else
+		{
+			sp--;
+			st[sp - 1] = arith_op(op, st[sp - 1], st[sp], &err);
+		}
+	}
+	*result = sp ? st[sp - 1] : 0;
+	return (err);
+}
+
+/**
+ * arith_op - Applies an operator with 64-bit wrap-around semantics.
+ * @op: The AR_* opcode, from AR_BOOL on.
+ * @x: The left operand (unused by unary operators).
+ * @y: The right operand, or the only one.
+ * @err: Set to 1 on division by zero.
+ *
+ * Return: The result.
+ */
+long arith_op(long op, long x, long y, int *err)
+{
+	unsigned long ux = x, uy = y;
+
+	if ((op == AR_DIV || op == AR_MOD) && y == 0)
+	{
+		print_error(ERR_ARITH_DIV, "");
+		*err = 1;
+		return (0);
+	}
+	switch (op)
+	{
+	case AR_BOOL:
+		return (y != 0);
+	case AR_NEG:
+		return (-uy);
+	case AR_NOT:
+		return (!y);
+	case AR_BNOT:
+		return (~y);
+	case AR_MUL:
+		return (ux * uy);
+	case AR_DIV:
+		return (y == -1 ? (long)-ux : x / y);
+	case AR_MOD:
+		return (y == -1 ? 0 : x % y);
+	case AR_ADD:
+		return (ux + uy);
+	case AR_SUB:
+		return (ux - uy);
+	case AR_SHL:
+		return (ux << (y & 63));
+	case AR_SHR:
+		return (x >> (y & 63));
+	}
+	if (op <= AR_NE)
+		return (op == AR_LT ? x < y : op == AR_LE ? x <= y :
+			op == AR_GT ? x > y : op == AR_GE ? x >= y :
+			op == AR_EQ ? x == y : x != y);
+	return (op == AR_AND ? x & y : op == AR_XOR ? x ^ y : x | y);
+}
+
+/**
+ * arith_get - Reads a variable as an integer.
+ * @var: The variable name.
+ * @num: Where to store the value. Unset and empty variables are 0.
+ *
+ * Return: 0 on success, or 1 if the value is not an integer.
+ */
+int arith_get(char *var, long *num)
+{
+	char **env = _getenv(var), *s, *end;
+	int neg = 0;
+
+	*num = 0;
+	if (!env)
+		return (0);
+	s = _strchr(*env, '=') + 1;
+	while (*s == ' ' || *s == '\t')
+		s++;
+	if (!*s)
+		return (0);
+	if (*s == '-' || *s == '+')
+		neg = *s++ == '-';
+	end = arith_num(s, num);
+	while (end && (*end == ' ' || *end == '\t'))
+		end++;
+	if (!end || *end)
+	{
+		print_error(ERR_ARITH_NUM, _strchr(*env, '=') + 1);
+		return (1);
+	}
+	if (neg)
+		*num = -(unsigned long)*num;
+	return (0);
+}
+
+/**
+ * arith_set - Assigns an integer to a variable.
+ * @var: The variable name.
+ * @num: The value.
+ *
+ * Return: 0 on success, or 1 if memory ran out.
+ */
+int arith_set(char *var, long num)
+{
+	char digits[24], *value;
+	int len = _strlen(var), n;
+
+	n = _itoa_buf(num, digits);
+	value = malloc(len + n + 2);
+	if (!value)
+		return (1);
+	_memcpy(value, var, len);
+	value[len] = '=';
+	_memcpy(value + len + 1, digits, n + 1);
+	if (env_set(_getenv(var), value) == -1)
+	{
+		free(value);
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,28 @@
+# Helpers shared by the benchmark scripts. Sourced, not run.
+#
+# Every script takes the shells to compare as arguments, ./hsh when none
+# are given, and prints one line per shell and case. Timings use GNU
+# date, so they are wall-clock times including process startup.
+
+[ $# -gt 0 ] || set -- ./hsh
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+
+# now_us - Prints the current time in microseconds.
+now_us()
+{
+	echo $(($(date +%s%N) / 1000))
+}
+
+# timed LABEL COMMAND... - Runs COMMAND, its output discarded, and prints
+# the time it took.
+timed()
+{
+	label=$1
+	shift
+	start=$(now_us)
+	"$@" > /dev/null
+	end=$(now_us)
+	printf '%-44s %9d us\n' "$label" $((end - start))
+}
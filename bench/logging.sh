@@ -0,0 +1,22 @@
+#!/bin/sh
+# Times a 20000-line script alternating echo and printf, with its output
+# sent to a file, and checks that every shell writes the same output.
+#
+# Usage: bench/logging.sh [SHELL...]
+
+. "$(dirname "$0")/common.sh"
+
+i=0
+while [ $i -lt 10000 ]; do
+	echo "echo step $i of the job"
+	echo "printf %s=%d, step $i"
+	i=$((i + 1))
+done > "$tmp/script"
+
+for sh; do
+	timed "$sh: 20000 echo/printf lines" \
+		sh -c '"$1" "$2" > "$3"' sh "$sh" "$tmp/script" "$tmp/out"
+	sum=$(cksum < "$tmp/out")
+	[ -z "$first" ] && first=$sum
+	[ "$sum" = "$first" ] || echo "$sh: output differs"
+done
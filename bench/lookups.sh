@@ -0,0 +1,99 @@
+#!/bin/sh
+# Counts the stat(2), fstatat(2) and access(2) calls a shell makes per
+# command lookup, with a PATH of 6 directories. A preloaded shim counts
+# the calls; the count for 1 run of a command is subtracted from the
+# count for 11 runs. Builds the shim with cc. HSH_PATH_WATCH is passed
+# on when set.
+#
+# Usage: bench/lookups.sh [SHELL...]
+
+. "$(dirname "$0")/common.sh"
+
+cat > "$tmp/shim.c" << 'SHIM'
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static long calls;
+static char *out, buf[4096];
+
+__attribute__((constructor)) static void shim_start(void)
+{
+	char *env = getenv("SHIM_OUT");
+
+	if (env && strlen(env) < sizeof(buf))
+		out = strcpy(buf, env);
+	unsetenv("SHIM_OUT");
+}
+
+__attribute__((destructor)) static void shim_end(void)
+{
+	FILE *f = out ? fopen(out, "w") : NULL;
+
+	if (f)
+		fprintf(f, "%ld\n", calls), fclose(f);
+}
+
+#define SHIM(name, params, args) \
+int name params \
+{ \
+	static int (*real) params; \
+	if (!real) \
+		real = (int (*) params)dlsym(RTLD_NEXT, #name); \
+	calls += (out != NULL); \
+	return (real args); \
+}
+
+SHIM(stat, (const char *p, void *s), (p, s))
+SHIM(stat64, (const char *p, void *s), (p, s))
+SHIM(lstat, (const char *p, void *s), (p, s))
+SHIM(fstatat, (int d, const char *p, void *s, int f), (d, p, s, f))
+SHIM(fstatat64, (int d, const char *p, void *s, int f), (d, p, s, f))
+SHIM(access, (const char *p, int m), (p, m))
+SHIM(faccessat, (int d, const char *p, int m, int f), (d, p, m, f))
+SHIM(__xstat, (int v, const char *p, void *s), (v, p, s))
+SHIM(__fxstatat, (int v, int d, const char *p, void *s, int f), \
+	(v, d, p, s, f))
+SHIM
+cc -shared -fPIC -o "$tmp/shim.so" "$tmp/shim.c" -ldl || exit 1
+
+for d in 1 2 3 4 5 6; do
+	mkdir "$tmp/d$d"
+done
+cp /bin/true "$tmp/d4/bench_cmd"
+path="$tmp/d1:$tmp/d2:$tmp/d3:$tmp/d4:$tmp/d5:$tmp/d6"
+
+# calls SHELL COMMAND RUNS - Prints the calls made by a script running
+# COMMAND RUNS times. The script ends with exit, so the shell does not
+# exec the last command in its place.
+calls()
+{
+	: > "$tmp/script"
+	i=0
+	while [ $i -lt $3 ]; do
+		echo "$2" >> "$tmp/script"
+		i=$((i + 1))
+	done
+	echo exit >> "$tmp/script"
+	env -i PATH="$path" PWD="$tmp" SHIM_OUT="$tmp/count" \
+		${HSH_PATH_WATCH:+HSH_PATH_WATCH=$HSH_PATH_WATCH} \
+		LD_PRELOAD="$tmp/shim.so" "$1" "$tmp/script" 2> /dev/null
+	cat "$tmp/count"
+}
+
+# per_lookup SHELL COMMAND - Prints the calls per lookup of COMMAND.
+per_lookup()
+{
+	one=$(calls "$1" "$2" 1)
+	many=$(calls "$1" "$2" 11)
+	echo $(((many - one) / 10))
+}
+
+for sh; do
+	printf '%-44s %9d calls\n' "$sh: found in directory 4 of 6" \
+		$(per_lookup "$sh" bench_cmd)
+	printf '%-44s %9d calls\n' "$sh: missing from all 6 directories" \
+		$(per_lookup "$sh" bench_missing)
+done
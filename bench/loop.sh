@@ -0,0 +1,13 @@
+#!/bin/sh
+# Times a while loop of N iterations, each running test and an
+# arithmetic expansion.
+#
+# Usage: N=1000000 bench/loop.sh [SHELL...]
+
+. "$(dirname "$0")/common.sh"
+
+n=${N:-1000000}
+for sh; do
+	timed "$sh: $n iterations" "$sh" -c \
+		"i=0; while [ \$i -lt $n ]; do i=\$((i + 1)); done"
+done
@@ -0,0 +1,24 @@
+#!/bin/sh
+# Times 200000-line scripts, read from standard input and given as an
+# argument, with and without HSH_IO_URING. One script holds only
+# comments, so reading dominates; the other runs a cheap builtin per line.
+#
+# Usage: bench/script_input.sh [SHELL...]
+
+. "$(dirname "$0")/common.sh"
+
+yes '# a comment about as long as a typical command line' |
+	head -n 200000 > "$tmp/comments"
+yes 'alias x=y' | head -n 200000 > "$tmp/aliases"
+
+for sh; do
+	for f in comments aliases; do
+		timed "$sh $f" "$sh" "$tmp/$f"
+		timed "$sh < $f" sh -c '"$1" < "$2"' sh "$sh" "$tmp/$f"
+		export HSH_IO_URING=1
+		timed "$sh $f, HSH_IO_URING=1" "$sh" "$tmp/$f"
+		timed "$sh < $f, HSH_IO_URING=1" \
+			sh -c '"$1" < "$2"' sh "$sh" "$tmp/$f"
+		unset HSH_IO_URING
+	done
+done
@@ -0,0 +1,30 @@
+#!/bin/sh
+# Times how long a shell takes to get to its first exec: N runs of a
+# script holding only /bin/true, with 1000 inherited environment
+# variables.
+#
+# Usage: N=2000 bench/startup.sh [SHELL...]
+
+. "$(dirname "$0")/common.sh"
+
+n=${N:-2000}
+i=0
+while [ $i -lt 1000 ]; do
+	export "BENCH_VAR_$i=$i-0123456789abcdef0123456789abcdef0123456789"
+	i=$((i + 1))
+done
+echo /bin/true > "$tmp/script"
+
+# runs SHELL - Starts SHELL n times.
+runs()
+{
+	i=0
+	while [ $i -lt $n ]; do
+		"$1" "$tmp/script"
+		i=$((i + 1))
+	done
+}
+
+for sh; do
+	timed "$sh: $n starts" runs "$sh"
+done
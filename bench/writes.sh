@@ -0,0 +1,40 @@
+#!/bin/sh
+# Counts the write(2) calls a shell makes for the output of env, alias and
+# help. A child reads syscw from /proc/PID/io of the shell once the
+# builtin is done; the count for the same script without the builtin is
+# subtracted.
+#
+# Usage: bench/writes.sh [SHELL...]
+
+. "$(dirname "$0")/common.sh"
+
+vars= defs=
+i=0
+while [ $i -lt 300 ]; do
+	vars="$vars V$i=value$i"
+	[ $i -lt 100 ] && defs="$defs a$i=cmd$i"
+	i=$((i + 1))
+done
+
+# writes SHELL SETUP COMMANDS - Prints the writes made by COMMANDS, run
+# after SETUP, one command per line.
+writes()
+{
+	printf '%s\n' "$2" > "$tmp/base"
+	printf '%s\n%s\n' "$2" "$3" > "$tmp/script"
+	for f in base script; do
+		echo '/bin/cat /proc/$$/io' >> "$tmp/$f"
+		echo '/bin/true' >> "$tmp/$f"
+		env -i $vars "$1" "$tmp/$f" 2> /dev/null | sed -n 's/^syscw: //p'
+	done | { read base; read n; echo $((n - base)); }
+}
+
+for sh; do
+	printf '%-44s %9d writes\n' "$sh: env, 300 variables" \
+		$(writes "$sh" "cd /" "env")
+	printf '%-44s %9d writes\n' "$sh: alias, 100 aliases" \
+		$(writes "$sh" "alias $defs" "alias")
+	printf '%-44s %9d writes\n' "$sh: help cd and help history" \
+		$(writes "$sh" "cd /" "help cd
+help history")
+done
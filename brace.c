@@ -0,0 +1,167 @@
+#include "shell.h"
+
+char **brace_words(char **words);
+int brace_word(argv_t *av, char *word);
+int brace_find(char *word, char **open, char **close);
+int brace_alts(argv_t *av, char *word, char *open, char *close);
+int brace_join(argv_t *av, char *word, char *open, char *alt, int len,
+	       char *close);
+
+/**
+ * brace_words - Expands the braces in the words of a command.
+ * @words: The words, as written.
+ *
+ * Return: words itself if none of them holds braces to expand. Otherwise
+ *         a malloc'd vector of the expanded words, still to go through
+ *         the other expansions, or NULL if memory ran out.
+ */
+char **brace_words(char **words)
+{
+	argv_t av;
+	char *open, *close;
+	int i;
+
+	for (i = 0; words[i] && !brace_find(words[i], &open, &close); i++)
+		;
+	if (!words[i])
+		return (words);
+	_memset(&av, 0, sizeof(av));
+	for (i = 0; words[i]; i++)
+	{
+		if (brace_word(&av, words[i]) == -1)
+		{
+			if (av.v)
+				free_args(av.v, av.v);
+			return (NULL);
+		}
+	}
+	return (av.v);
+}
+
+/**
+ * brace_word - Expands the braces in a word.
+ * @av: The vector the resulting words are added to.
+ * @word: The word.
+ *
+ * Return: 0 on success, or -1 if memory ran out.
+ */
+int brace_word(argv_t *av, char *word)
+{
+	char *open, *close, *copy;
+	int type = brace_find(word, &open, &close);
+
+	if (!type)
+	{
+		copy = malloc(_strlen(word) + 1);
+		return (argv_push(av, copy ? _strcpy(copy, word) : NULL));
+	}
+	if (type == 1)
+		return (brace_alts(av, word, open, close) == -1 ? -1 : 0);
+	return (brace_seq(av, word, open, close) == -1 ? -1 : 0);
+}
+
+/**
+ * brace_find - Finds the first group of braces to expand in a word.
+ * @word: The word.
+ * @open: Where to store the group's '{'.
+ * @close: Where to store the group's '}'.
+ *
+ * Return: 1 for a list of alternatives, 2 for a sequence, or 0 if there
+ *         is no group. Braces holding neither, such as "{}" or "{a}", are
+ *         kept, and so are ${...} and the commands of $(...).
+ */
+int brace_find(char *word, char **open, char **close)
+{
+	char *p, *q;
+
+	for (p = word; *p; p++)
+	{
+		if (*p == '\\' && p[1])
+			p++;
+		else if (*p == '$' && (p[1] == '(' || p[1] == '{'))
+		{
+			p = brace_skip(p + 1);
+			if (!p)
+				return (0);
+		}
+		else if (*p == '{' && (q = brace_skip(p)) != NULL)
+		{
+			*open = p;
+			*close = q;
+			if (brace_alts(NULL, word, p, q) > 1)
+				return (1);
+			if (brace_seq(NULL, word, p, q))
+				return (2);
+		}
+	}
+	return (0);
+}
+
+/**
+ * brace_alts - Expands a word for each alternative of a group of braces.
+ * @av: The vector the resulting words are added to, or NULL to only
+ *      count the alternatives.
+ * @word: The word.
+ * @open: The group's '{'.
+ * @close: The group's '}'.
+ *
+ * Return: The number of alternatives, or -1 if memory ran out.
+ *
+ * Description: The alternatives are separated by the commas outside of
+ *              nested groups, which are left for the next round.
+ */
+int brace_alts(argv_t *av, char *word, char *open, char *close)
+{
+	char *alt, *p;
+	int depth = 0, n = 0;
+
+	for (alt = p = open + 1; p <= close; p++)
+	{
+		if (*p == '\\' && p[1])
+			p++;
+		else if (*p == '{')
+			depth++;
+		else if (*p == '}' && depth)
+			depth--;
+		else if ((*p == ',' || p == close) && !depth)
+		{
+			if (av && brace_join(av, word, open, alt, p - alt,
+					      close) == -1)
+				return (-1);
+			alt = p + 1;
+			n++;
+		}
+	}
+	return (n);
+}
+
+/**
+ * brace_join - Expands a word with a group of braces replaced by one of
+ *              its alternatives.
+ * @av: The vector the resulting words are added to.
+ * @word: The word.
+ * @open: The group's '{'.
+ * @alt: The alternative.
+ * @len: The length of the alternative.
+ * @close: The group's '}'.
+ *
+ * Return: 0 on success, or -1 if memory ran out.
+ *
+ * Description: The result is expanded again, for the groups nested in
+ *              the alternative or following it.
+ */
+int brace_join(argv_t *av, char *word, char *open, char *alt, int len,
+	       char *close)
+{
+	int pre = open - word, ret;
+	char *s = malloc(pre + len + _strlen(close + 1) + 1);
+
+	if (!s)
+		return (-1);
+	_memcpy(s, word, pre);
+	_memcpy(s + pre, alt, len);
+	_strcpy(s + pre + len, close + 1);
+	ret = brace_word(av, s);
+	free(s);
+	return (ret);
+}
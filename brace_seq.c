@@ -0,0 +1,158 @@
+#include "shell.h"
+
+int brace_seq(argv_t *av, char *word, char *open, char *close);
+int brace_range(char *s, char *end, brace_seq_t *r);
+int brace_num(char *s, long *n);
+int brace_item(char *buf, long v, brace_seq_t *r);
+char *brace_skip(char *p);
+
+/**
+ * brace_seq - Expands a word for each value of a {FROM..TO..STEP} group.
+ * @av: The vector the resulting words are added to, or NULL to only
+ *      check the group.
+ * @word: The word.
+ * @open: The group's '{'.
+ * @close: The group's '}'.
+ *
+ * Return: 1 if the group is a sequence, 0 if it is not, or -1 if memory
+ *         ran out.
+ *
+ * Description: FROM and TO are both integers or both letters, and the
+ *              values run from one to the other in either direction.
+ */
+int brace_seq(argv_t *av, char *word, char *open, char *close)
+{
+	brace_seq_t r;
+	char item[24];
+	long v, step;
+	int len;
+
+	if (!brace_range(open + 1, close, &r))
+		return (0);
+	step = r.from <= r.to ? r.step : -r.step;
+	for (v = r.from; av && (step > 0 ? v <= r.to : v >= r.to); v += step)
+	{
+		len = brace_item(item, v, &r);
+		if (brace_join(av, word, open, item, len, close) == -1)
+			return (-1);
+	}
+	return (1);
+}
+
+/**
+ * brace_range - Parses the inside of a {FROM..TO..STEP} group.
+ * @s: The start of the inside.
+ * @end: The group's '}'.
+ * @r: Where to store the sequence.
+ *
+ * Return: 1 if it is a sequence, or 0 if it is not.
+ */
+int brace_range(char *s, char *end, brace_seq_t *r)
+{
+	long v[3] = {0, 0, 1};
+	int len[3] = {0, 0, 0}, i, alpha = 0, pad = 0;
+
+	for (i = 0; i < 3 && s < end; i++)
+	{
+		if (i && (s[0] != '.' || s[1] != '.'))
+			return (0);
+		s += i ? 2 : 0;
+		len[i] = brace_num(s, &v[i]);
+		if (i < 2 && len[i] > 1)
+			pad |= *s == '0' || (*s == '-' && s[1] == '0');
+		if (!len[i] && i < 2 && ((*s | 32) >= 'a' && (*s | 32) <= 'z'))
+		{
+			alpha |= 1 << i;
+			v[i] = *s;
+			len[i] = 1;
+		}
+		if (!len[i])
+			return (0);
+		s += len[i];
+	}
+	if (s != end || i < 2 || alpha == 1 || alpha == 2)
+		return (0);
+	r->from = v[0];
+	r->to = v[1];
+	r->step = v[2] < 0 ? -v[2] : v[2] ? v[2] : 1;
+	r->alpha = alpha;
+	r->width = pad ? (len[0] > len[1] ? len[0] : len[1]) : 0;
+	return (1);
+}
+
+/**
+ * brace_num - Parses an integer of a sequence.
+ * @s: The text.
+ * @n: Where to store the integer.
+ *
+ * Return: The length of the integer, including its '-' sign, or 0 if
+ *         there is none. Integers of more than 18 digits are refused,
+ *         which keeps stepping through a sequence from overflowing.
+ */
+int brace_num(char *s, long *n)
+{
+	int i = *s == '-';
+
+	*n = 0;
+	for (; s[i] >= '0' && s[i] <= '9'; i++)
+	{
+		if (i > 18)
+			return (0);
+		*n = *n * 10 + (s[i] - '0');
+	}
+	if (i == (*s == '-'))
+		return (0);
+	if (*s == '-')
+		*n = -*n;
+	return (i);
+}
+
+/**
+ * brace_item - Formats a value of a sequence.
+ * @buf: The buffer, of at least 24 bytes.
+ * @v: The value.
+ * @r: The sequence.
+ *
+ * Return: The length of the text.
+ */
+int brace_item(char *buf, long v, brace_seq_t *r)
+{
+	char digits[24];
+	int len, neg = v < 0, pad;
+
+	if (r->alpha)
+	{
+		buf[0] = v;
+		buf[1] = '\0';
+		return (1);
+	}
+	len = _itoa_buf(v, digits);
+	pad = r->width > len ? r->width - len : 0;
+	buf[0] = '-';
+	_memset(buf + neg, '0', pad);
+	_strcpy(buf + neg + pad, digits + neg);
+	return (len + pad);
+}
+
+/**
+ * brace_skip - Finds the end of a group of braces or parentheses.
+ * @p: The '{' or '('.
+ *
+ * Return: The matching '}' or ')', or NULL if there is none.
+ */
+char *brace_skip(char *p)
+{
+	char open = *p, close = *p == '(' ? ')' : '}';
+	int depth = 0;
+
+	for (; *p; p++)
+	{
+		if (*p == '\\' && p[1])
+			p++;
+		else if (*p == open)
+			depth++;
+		else if (*p == close && !--depth)
+			return (p);
+	}
+	return (NULL);
+}
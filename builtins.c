@@ -96,19 +96,17 @@ void set_alias(char *var_name, char *value)
  */
 void print_alias(alias_t *alias)
 {
-	char *alias_string;
-	int len = _strlen(alias->name) + _strlen(alias->value) + 4;
+	struct iovec iov[4];
 
-	alias_string = malloc(sizeof(char) * (len + 1));
-	if (!alias_string)
-		return;
-	_strcpy(alias_string, alias->name);
-	_strcat(alias_string, "='");
-	_strcat(alias_string, alias->value);
-	_strcat(alias_string, "'\n");
-
-	write(STDOUT_FILENO, alias_string, len);
-	free(alias_string);
+	iov[0].iov_base = alias->name;
+	iov[0].iov_len = _strlen(alias->name);
+	iov[1].iov_base = "='";
+	iov[1].iov_len = 2;
+	iov[2].iov_base = alias->value;
+	iov[2].iov_len = _strlen(alias->value);
+	iov[3].iov_base = "'\n";
+	iov[3].iov_len = 2;
+	out_writev(iov, 4);
 }
 /**
  * replace_aliases - Goes through the arguments and replace any matching alias
@@ -4,6 +4,7 @@ void help_env(void);
 void help_setenv(void);
 void help_unsetenv(void);
 void help_history(void);
+void help_time(void);
 
 /**
  * help_env - Displays information on the shellby builtin command 'env'.
@@ -12,7 +13,7 @@ void help_env(void)
 {
 	char *msg = "env: env\n\tPrints the current environment.\n";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 }
 
 /**
@@ -22,11 +23,11 @@ void help_setenv(void)
 {
 	char *msg = "setenv: setenv [VARIABLE] [VALUE]\n\tInitializes a new";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "environment variable, or modifies an existing one.\n\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "\tUpon failure, prints a message to stderr.\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 }
 
 /**
@@ -37,9 +38,42 @@ void help_unsetenv(void)
 {
 	char *msg = "unsetenv: unsetenv [VARIABLE]\n\tRemoves an ";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "environmental variable.\n\n\tUpon failure, prints a ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "message to stderr.\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
+}
+
+/**
+ * help_history - Displays information on the shellby builtin command
+ * 'history'.
+ */
+void help_history(void)
+{
+	char *msg = "history: history [N | -s STRING]\n\tPrints the command ";
+
+	out_puts(msg);
+	msg = "history shared by all shells through ~/.hsh_history.\n\n";
+	out_puts(msg);
+	msg = "\tWith N, prints only the last N entries. With -s, prints ";
+	out_puts(msg);
+	msg = "the entries containing STRING.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_time - Displays information on the shellby keyword 'time'.
+ */
+void help_time(void)
+{
+	char *msg = "time: time COMMAND\n\tRuns COMMAND and prints its ";
+
+	out_puts(msg);
+	msg = "resource usage to stderr as a JSON line.\n\n\tWhen ";
+	out_puts(msg);
+	msg = "HSH_RUSAGE_LOG names a file, the usage of every command ";
+	out_puts(msg);
+	msg = "is appended to it.\n";
+	out_puts(msg);
 }
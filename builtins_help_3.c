@@ -0,0 +1,90 @@
+#include "shell.h"
+
+void help_limit(void);
+void help_echo(void);
+void help_printf(void);
+void help_test(void);
+
+/**
+ * help_limit - Displays information on the shellby keyword 'limit'.
+ */
+void help_limit(void)
+{
+	char *msg = "limit: limit [--mem SIZE] [--cpu N] [--time SECS] ";
+
+	out_puts(msg);
+	msg = "[--nofile N] [--] COMMAND\n\tRuns COMMAND with resource ";
+	out_puts(msg);
+	msg = "limits. SIZE takes a K, M or G suffix, N CPUs may be ";
+	out_puts(msg);
+	msg = "fractional and SECS is CPU time.\n\n\tMemory and CPU are ";
+	out_puts(msg);
+	msg = "enforced by a cgroup v2 leaf when the host delegates the ";
+	out_puts(msg);
+	msg = "controllers; otherwise memory falls back to RLIMIT_AS and ";
+	out_puts(msg);
+	msg = "CPU to pinning the command to N CPUs.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_echo - Displays information on the shellby builtin command 'echo'.
+ */
+void help_echo(void)
+{
+	char *msg = "echo: echo [-n] [STRING ...]\n\tWrites the STRINGs, ";
+
+	out_puts(msg);
+	msg = "separated by spaces and followed by a newline, to standard ";
+	out_puts(msg);
+	msg = "output.\n\n\t-n\tDo not write the newline.\n\n\tThe ";
+	out_puts(msg);
+	msg = "escapes \\a \\b \\f \\n \\r \\t \\v \\\\ and \\0NNN ";
+	out_puts(msg);
+	msg = "are interpreted; \\c ends the output.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_printf - Displays information on the shellby builtin command
+ * 'printf'.
+ */
+void help_printf(void)
+{
+	char *msg = "printf: printf FORMAT [ARGUMENT ...]\n\tWrites the ";
+
+	out_puts(msg);
+	msg = "ARGUMENTs under the control of FORMAT.\n\n\tFORMAT takes ";
+	out_puts(msg);
+	msg = "the conversions %d %i %o %u %x %X %c %s %b and %%, with ";
+	out_puts(msg);
+	msg = "flags, field widths and precisions. %b writes its argument ";
+	out_puts(msg);
+	msg = "with the escapes of echo interpreted. FORMAT is reused ";
+	out_puts(msg);
+	msg = "while ARGUMENTs are left.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_test - Displays information on the shellby builtin commands 'test'
+ * and '['.
+ */
+void help_test(void)
+{
+	char *msg = "test: test EXPRESSION or [ EXPRESSION ]\n\tExits with ";
+
+	out_puts(msg);
+	msg = "status 0 if EXPRESSION is true, 1 if it is false and 2 if ";
+	out_puts(msg);
+	msg = "it is malformed.\n\n\tStrings: -n S, -z S, S1 = S2, S1 != ";
+	out_puts(msg);
+	msg = "S2, S1 < S2, S1 > S2.\n\tIntegers: N1 -eq -ne -lt -le -gt ";
+	out_puts(msg);
+	msg = "-ge N2.\n\tFiles: -b -c -d -e -f -g -h -L -k -p -r -s -S ";
+	out_puts(msg);
+	msg = "-t -u -w -x -O -G FILE, F1 -nt -ot -ef F2.\n\tCombine ";
+	out_puts(msg);
+	msg = "with ! EXPR, EXPR -a EXPR, EXPR -o EXPR and ( EXPR ).\n";
+	out_puts(msg);
+}
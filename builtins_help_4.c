@@ -0,0 +1,85 @@
+#include "shell.h"
+
+void help_break(void);
+void help_continue(void);
+void help_return(void);
+void help_local(void);
+int help_more(char *cmd);
+
+/**
+ * help_break - Displays information on the shellby builtin command 'break'.
+ */
+void help_break(void)
+{
+	char *msg = "break: break [N]\n\tLeaves the innermost for, while ";
+
+	out_puts(msg);
+	msg = "or until loop, or the N innermost loops.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_continue - Displays information on the shellby builtin command
+ * 'continue'.
+ */
+void help_continue(void)
+{
+	char *msg = "continue: continue [N]\n\tSkips to the next pass of ";
+
+	out_puts(msg);
+	msg = "the innermost for, while or until loop, or of the Nth ";
+	out_puts(msg);
+	msg = "enclosing loop.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_return - Displays information on the shellby builtin command
+ * 'return'.
+ */
+void help_return(void)
+{
+	char *msg = "return: return [N]\n\tReturns from a function with ";
+
+	out_puts(msg);
+	msg = "the value N, or with the value of the last command run.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_local - Displays information on the shellby builtin command 'local'.
+ */
+void help_local(void)
+{
+	char *msg = "local: local NAME[=VALUE] ...\n\tMakes the variables ";
+
+	out_puts(msg);
+	msg = "local to the running function: their values are restored ";
+	out_puts(msg);
+	msg = "when it returns.\n";
+	out_puts(msg);
+}
+
+/**
+ * help_more - Displays information on the loop, function and xargs
+ *             builtins.
+ * @cmd: The builtin to describe.
+ *
+ * Return: 1 if cmd is one of them, or 0 if it is not.
+ */
+int help_more(char *cmd)
+{
+	if (_strcmp(cmd, "break") == 0)
+		help_break();
+	else if (_strcmp(cmd, "continue") == 0)
+		help_continue();
+	else if (_strcmp(cmd, "return") == 0)
+		help_return();
+	else if (_strcmp(cmd, "local") == 0)
+		help_local();
+	else if (_strcmp(cmd, "xargs") == 0)
+		help_xargs();
+	else
+		return (0);
+	return (1);
+}
@@ -0,0 +1,23 @@
+#include "shell.h"
+
+void help_xargs(void);
+
+/**
+ * help_xargs - Displays information on the shellby builtin command 'xargs'.
+ */
+void help_xargs(void)
+{
+	char *msg = "xargs: xargs [-0] [-n N] [-P N] [COMMAND [ARG ...]]";
+
+	out_puts(msg);
+	msg = "\n\tRuns COMMAND with ARGs followed by the items read from ";
+	out_puts(msg);
+	msg = "standard input, separated by blanks, or by '\\0' with -0. ";
+	out_puts(msg);
+	msg = "Items are packed into as few runs as ARG_MAX allows, at ";
+	out_puts(msg);
+	msg = "most N per run with -n, and up to N runs go at once with -P. ";
+	out_puts(msg);
+	msg = "COMMAND defaults to echo and is not run without items.\n";
+	out_puts(msg);
+}
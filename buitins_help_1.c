@@ -13,19 +13,33 @@ void help_all(void)
 {
 	char *msg = "Shellby\nThese shell commands are defined internally.\n";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "Type 'help' to see this list.\nType 'help name' to find ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "out more about the function 'name'.\n\n  alias   \t";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "alias [NAME[='VALUE'] ...]\n  cd    \tcd   ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "[DIRECTORY]\n  exit    \texit [STATUS]\n  env     \tenv";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "\n  setenv  \tsetenv [VARIABLE] [VALUE]\n  unsetenv\t";
-	write(STDOUT_FILENO, msg, _strlen(msg));
-	msg = "unsetenv [VARIABLE]\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
+	msg = "unsetenv [VARIABLE]\n  history \thistory [N | -s STRING]\n";
+	out_puts(msg);
+	msg = "  time    \ttime COMMAND\n  limit   \tlimit [--mem SIZE] ";
+	out_puts(msg);
+	msg = "[--cpu N] [--time SECS] [--nofile N] [--] COMMAND\n";
+	out_puts(msg);
+	msg = "  echo    \techo [-n] [STRING ...]\n  printf  \tprintf ";
+	out_puts(msg);
+	msg = "FORMAT [ARGUMENT ...]\n  test    \ttest EXPRESSION, ";
+	out_puts(msg);
+	msg = "[ EXPRESSION ]\n  break   \tbreak [N]\n  continue\tcontinue ";
+	out_puts(msg);
+	msg = "[N]\n  return  \treturn [N]\n  local   \tlocal NAME[=VALUE] ";
+	out_puts(msg);
+	msg = "...\n  xargs   \txargs [-0] [-n N] [-P N] [COMMAND [ARG ...]]\n";
+	out_puts(msg);
 }
 
 /**
@@ -35,19 +49,19 @@ void help_alias(void)
 {
 	char *msg = "alias: alias [NAME[='VALUE'] ...]\n\tHandles aliases.\n";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "\n\talias: Prints a list of all aliases, one per line, in ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "the format NAME='VALUE'.\n\talias name [name2 ...]:prints";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = " the aliases name, name2, etc. one per line, in the ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "form NAME='VALUE'.\n\talias NAME='VALUE' [...]: Defines";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = " an alias for each NAME whose VALUE is given. If NAME ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "is already an alias, replace its value with VALUE.\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 }
 
 /**
@@ -57,17 +71,17 @@ void help_cd(void)
 {
 	char *msg = "cd: cd [DIRECTORY]\n\tChanges the current directory of the";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = " process to DIRECTORY.\n\n\tIf no argument is given, the ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "command is interpreted as cd $HOME. If the argument '-' is";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = " given, the command is interpreted as cd $OLDPWD.\n\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "\tThe environment variables PWD and OLDPWD are updated ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "after a change of directory.\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 }
 
 /**
@@ -77,13 +91,13 @@ void help_exit(void)
 {
 	char *msg = "exit: exit [STATUS]\n\tExits the shell.\n\n\tThe ";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "STATUS argument is the integer used to exit the shell.";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = " If no argument is given, the command is interpreted as";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = " exit 0.\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 }
 
 /**
@@ -93,9 +107,9 @@ void help_help(void)
 {
 	char *msg = "help: help\n\tSee all possible Shellby builtin commands.\n";
 
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "\n      help [BUILTIN NAME]\n\tSee specific information on each ";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 	msg = "builtin command.\n";
-	write(STDOUT_FILENO, msg, _strlen(msg));
+	out_puts(msg);
 }
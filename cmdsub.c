@@ -0,0 +1,167 @@
+#include "shell.h"
+
+char *cmdsub_expand(char *start, int *used, int *exe_ret);
+void cmdsub_exec(node_t *tree, cmdsub_t *out, int *exe_ret);
+int cmdsub_safe(node_t *n, int depth);
+int cmdsub_cmd_safe(char **words, int depth);
+int cmdsub_word_safe(char *word);
+
+/**
+ * cmdsub_expand - Runs a command substitution.
+ * @start: The "$(" starting the substitution.
+ * @used: Where to store the length of the substitution, 0 if it is not
+ *        closed and is kept as is, or -1 if its commands could not be
+ *        parsed.
+ * @exe_ret: The return value of the last executed command. It becomes the
+ *           return value of the substituted commands.
+ *
+ * Return: The malloc'd output of the commands without its trailing
+ *         newlines, or NULL if it is empty.
+ */
+char *cmdsub_expand(char *start, int *used, int *exe_ret)
+{
+	cmdsub_t out;
+	node_t *tree;
+	char *text;
+	int len, depth = 0, status;
+
+	for (len = 1; start[len]; len++)
+	{
+		depth += (start[len] == '(') - (start[len] == ')');
+		if (!depth)
+			break;
+	}
+	*used = start[len] ? -1 : 0;
+	text = start[len] ? malloc(len - 1) : NULL;
+	if (!text)
+		return (NULL);
+	text[0] = '\0';
+	_strncat(text, start + 2, len - 2);
+	status = parse_script(text, &tree);
+	free(text);
+	if (status == PARSE_MORE)
+		print_error(ERR_SYNTAX, "end of file");
+	if (status != PARSE_OK)
+		return (NULL);
+	_memset(&out, 0, sizeof(out));
+	cmdsub_exec(tree, &out, exe_ret);
+	tree_free(tree);
+	*used = len + 1;
+	while (out.len && out.buf[out.len - 1] == '\n')
+		out.len--;
+	if (out.len)
+		out.buf[out.len] = '\0';
+	else
+		free(out.buf);
+	return (out.len ? out.buf : NULL);
+}
+
+/**
+ * cmdsub_exec - Runs the commands of a substitution, capturing their
+ *               output.
+ * @tree: The parsed commands.
+ * @out: The capture buffer.
+ * @exe_ret: The return value of the last executed command.
+ *
+ * Description: Commands that cannot change the shell's state run in the
+ *              shell itself, with builtin output going straight into the
+ *              buffer: a substitution of builtins and functions never
+ *              forks. Anything else runs in a forked subshell, so that
+ *              its assignments, cd or exit stay inside the substitution.
+ */
+void cmdsub_exec(node_t *tree, cmdsub_t *out, int *exe_ret)
+{
+	cmdsub_t *saved = cmdsub_out;
+
+	cmdsub_out = out;
+	if (cmdsub_safe(tree, 0))
+		exec_list(tree, exe_ret, 0);
+	else
+		cmdsub_fork(tree, exe_ret);
+	cmdsub_out = saved;
+	cmdsub_status = *exe_ret;
+}
+
+/**
+ * cmdsub_safe - Checks if parsed commands leave the shell's state alone.
+ * @n: The first command of the list, or NULL.
+ * @depth: The number of function bodies entered so far.
+ *
+ * Return: 1 if the commands can run in the shell itself, or 0 if they
+ *         define functions, set variables (including for loop variables
+ *         and arithmetic assignments) or run builtins that change the
+ *         shell.
+ */
+int cmdsub_safe(node_t *n, int depth)
+{
+	int i;
+
+	for (; n; n = n->next)
+	{
+		if (n->type == N_FOR || n->type == N_FUNC ||
+		    depth > CMDSUB_DEPTH)
+			return (0);
+		if (n->type == N_CMD && n->words &&
+		    !cmdsub_cmd_safe(n->words, depth))
+			return (0);
+		for (i = 0; n->words && n->words[i]; i++)
+		{
+			if (!cmdsub_word_safe(n->words[i]))
+				return (0);
+		}
+		if ((n->name && !cmdsub_word_safe(n->name)) ||
+		    !cmdsub_safe(n->a, depth) || !cmdsub_safe(n->b, depth) ||
+		    !cmdsub_safe(n->c, depth))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * cmdsub_cmd_safe - Checks if a simple command leaves the shell's state
+ *                   alone.
+ * @words: The words of the command, as written.
+ * @depth: The number of function bodies entered so far.
+ *
+ * Return: 1 if it can run in the shell itself, or 0 if it cannot.
+ *
+ * Description: The command name must be known before expansion, and
+ *              must not be an alias. A function is safe if its body is.
+ */
+int cmdsub_cmd_safe(char **words, int depth)
+{
+	static char *unsafe[] = { "exit", "cd", "setenv", "unsetenv", "alias",
+		"local", "return", "break", "continue", "time", "xargs", NULL };
+	alias_t *a;
+	node_t *body;
+	int i, len = name_len(words[0]);
+
+	if ((len && words[0][len] == '=') || _strchr(words[0], '$'))
+		return (0);
+	for (i = 0; unsafe[i]; i++)
+	{
+		if (_strcmp(words[0], unsafe[i]) == 0)
+			return (0);
+	}
+	for (a = aliases; a; a = a->next)
+	{
+		if (_strcmp(a->name, words[0]) == 0)
+			return (0);
+	}
+	body = func_find(words[0]);
+	return (!body || cmdsub_safe(body, depth + 1));
+}
+
+/**
+ * cmdsub_word_safe - Checks that a word sets no variable when expanded.
+ * @word: The word, as written.
+ *
+ * Return: 0 if it holds an arithmetic expansion that may assign, or 1.
+ */
+int cmdsub_word_safe(char *word)
+{
+	char *arith = _strstr(word, "$((");
+
+	return (!arith || (!_strchr(arith, '=') && !_strstr(arith, "++") &&
+			   !_strstr(arith, "--")));
+}
@@ -0,0 +1,124 @@
+#include "shell.h"
+
+void cmdsub_add(cmdsub_t *out, char *buf, size_t len);
+void cmdsub_pipe(void);
+void cmdsub_child(void);
+void cmdsub_read(void);
+void cmdsub_fork(node_t *tree, int *exe_ret);
+
+/**
+ * cmdsub_add - Appends output to a capture buffer.
+ * @out: The capture buffer.
+ * @buf: The output.
+ * @len: The number of bytes.
+ *
+ * Description: The buffer doubles as it fills and always keeps a byte
+ *              free for the terminating '\0'. Output that does not fit
+ *              once memory runs out is dropped.
+ */
+void cmdsub_add(cmdsub_t *out, char *buf, size_t len)
+{
+	size_t cap = out->cap ? out->cap : 256;
+	char *new;
+
+	while (cap < out->len + len + 1)
+		cap *= 2;
+	if (cap != out->cap)
+	{
+		new = _realloc(out->buf, out->cap, cap);
+		if (!new)
+			return;
+		out->buf = new;
+		out->cap = cap;
+	}
+	_memcpy(out->buf + out->len, buf, len);
+	out->len += len;
+}
+
+/**
+ * cmdsub_pipe - Opens the pipe the next external command writes its output
+ *               to, while a substitution is captured.
+ */
+void cmdsub_pipe(void)
+{
+	if (cmdsub_out && pipe2(cmdsub_out->fd, O_CLOEXEC) == -1)
+		cmdsub_out->fd[0] = cmdsub_out->fd[1] = -1;
+}
+
+/**
+ * cmdsub_child - Sends a forked child's standard output into the pipe
+ *                opened by cmdsub_pipe.
+ *
+ * Description: The child no longer captures output itself: builtins it
+ *              runs write to the pipe like any program would.
+ */
+void cmdsub_child(void)
+{
+	if (!cmdsub_out)
+		return;
+	if (cmdsub_out->fd[0] != -1)
+	{
+		dup2(cmdsub_out->fd[1], STDOUT_FILENO);
+		close(cmdsub_out->fd[0]);
+		close(cmdsub_out->fd[1]);
+	}
+	cmdsub_out = NULL;
+}
+
+/**
+ * cmdsub_read - Reads the output of a forked child from the pipe opened by
+ *               cmdsub_pipe, until the child closes it.
+ */
+void cmdsub_read(void)
+{
+	char buf[CMDSUB_READ];
+	ssize_t n;
+
+	if (!cmdsub_out || cmdsub_out->fd[0] == -1)
+		return;
+	close(cmdsub_out->fd[1]);
+	while ((n = read(cmdsub_out->fd[0], buf, CMDSUB_READ)) != 0)
+	{
+		if (n == -1 && errno != EINTR)
+			break;
+		if (n > 0)
+			cmdsub_add(cmdsub_out, buf, n);
+	}
+	close(cmdsub_out->fd[0]);
+	cmdsub_out->fd[0] = cmdsub_out->fd[1] = -1;
+}
+
+/**
+ * cmdsub_fork - Runs the commands of a substitution in a subshell.
+ * @tree: The parsed commands.
+ * @exe_ret: The return value of the last executed command. It becomes the
+ *           return value of the subshell.
+ *
+ * Description: The subshell's last command replaces it instead of forking
+ *              again, so a substituted program costs a single fork.
+ */
+void cmdsub_fork(node_t *tree, int *exe_ret)
+{
+	pid_t pid;
+
+	out_flush();
+	cmdsub_pipe();
+	pid = fork();
+	if (pid == 0)
+	{
+		sig_child();
+		uring_close();
+		cmdsub_child();
+		exec_list(tree, exe_ret, 1);
+		out_flush();
+		_exit(*exe_ret);
+	}
+	cmdsub_read();
+	if (pid == -1)
+	{
+		perror("Error child:");
+		*exe_ret = 1;
+		return;
+	}
+	*exe_ret = wait_child(pid);
+}
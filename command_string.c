@@ -0,0 +1,82 @@
+#include "shell.h"
+
+int run_commands(char *line, int *exe_ret, int tail);
+int run_tree(node_t *tree, int status, int *exe_ret, int tail);
+int proc_string_commands(char **argv, int *exe_ret);
+
+/**
+ * run_commands - Parses and runs commands.
+ * @line: The commands. Newlines separate commands like ';'.
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing follows these commands, so that the final
+ *        command may replace the shell instead of forking.
+ *
+ * Return: The return value of the last executed command.
+ */
+int run_commands(char *line, int *exe_ret, int tail)
+{
+	node_t *tree;
+	int status;
+
+	status = parse_script(line, &tree);
+	return (run_tree(tree, status, exe_ret, tail));
+}
+
+/**
+ * run_tree - Runs parsed commands and frees them.
+ * @tree: The first command, or NULL.
+ * @status: The result of parsing the commands (PARSE_*).
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing follows these commands.
+ *
+ * Return: If the commands could not be parsed - 2.
+ *         Otherwise - the return value of the last executed command.
+ *
+ * Description: Commands still incomplete at the end of the input are a
+ *              syntax error. A return outside of a function stops them.
+ */
+int run_tree(node_t *tree, int status, int *exe_ret, int tail)
+{
+	int ret;
+
+	if (status == PARSE_MORE)
+		print_error(ERR_SYNTAX, "end of file");
+	if (status != PARSE_OK)
+	{
+		*exe_ret = 2;
+		return (*exe_ret);
+	}
+	stat_cache_reset();
+	ret = exec_list(tree, exe_ret, tail);
+	func_return = 0;
+	tree_free(tree);
+	return (ret);
+}
+
+/**
+ * proc_string_commands - Runs the command string given with -c.
+ * @argv: The arguments following -c. argv[0] is the command string,
+ *        argv[1], if present, replaces the program name and the rest are
+ *        the positional parameters.
+ * @exe_ret: Return value of the last executed command.
+ *
+ * Return: If the command string is missing - 2.
+ *	   Otherwise the return value of the last command ran.
+ *
+ * Description: The string is parsed straight from the argument memory.
+ */
+int proc_string_commands(char **argv, int *exe_ret)
+{
+	if (!argv[0])
+	{
+		print_error(ERR_OPT_ARG, "-c");
+		*exe_ret = 2;
+		return (*exe_ret);
+	}
+	if (argv[1])
+		name = argv[1];
+	pos_args = argv + 1 + (argv[1] != NULL);
+	for (pos_count = 0; pos_args[pos_count]; pos_count++)
+		;
+	return (run_commands(argv[0], exe_ret, 1));
+}
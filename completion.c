@@ -0,0 +1,161 @@
+#include "shell.h"
+
+int match_add(match_t *m, char *name, int len, char suffix);
+int match_cmp(const void *a, const void *b);
+void complete_list(edit_t *e, match_t *m);
+void complete_insert(edit_t *e, match_t *m, int blen);
+void edit_complete(edit_t *e);
+
+/**
+ * match_add - Adds a completion candidate to a match list.
+ * @m: The match list.
+ * @name: The candidate.
+ * @len: The length of name.
+ * @suffix: A character to append to the candidate, or '\0'.
+ *
+ * Return: If an error occurs - -1.
+ *         Otherwise - 0.
+ */
+int match_add(match_t *m, char *name, int len, char suffix)
+{
+	char **v, *copy;
+
+	if (m->len == m->cap)
+	{
+		v = _realloc(m->v, sizeof(char *) * m->cap,
+				sizeof(char *) * (m->cap ? m->cap * 2 : 16));
+		if (!v)
+			return (-1);
+		m->v = v;
+		m->cap = m->cap ? m->cap * 2 : 16;
+	}
+	copy = malloc(len + 2);
+	if (!copy)
+		return (-1);
+	_memcpy(copy, name, len);
+	copy[len] = suffix;
+	copy[len + (suffix != '\0')] = '\0';
+	m->v[m->len++] = copy;
+	return (0);
+}
+
+/**
+ * match_cmp - Orders two completion candidates for qsort.
+ * @a: A pointer to the first candidate.
+ * @b: A pointer to the second candidate.
+ *
+ * Return: The byte difference of the candidates.
+ */
+int match_cmp(const void *a, const void *b)
+{
+	return (_strcmp(*(char **)a, *(char **)b));
+}
+
+/**
+ * complete_list - Prints the candidates below the line.
+ * @e: The editor state.
+ * @m: The match list.
+ */
+void complete_list(edit_t *e, match_t *m)
+{
+	char out[EDIT_MAX];
+	int i, n = 0, col = 0, len;
+
+	out[n++] = '\n';
+	for (i = 0; i < m->len; i++)
+	{
+		len = _strlen(m->v[i]);
+		if (n + len + 3 >= EDIT_MAX)
+			break;
+		if (col > 0 && col + len + 2 > e->cols)
+		{
+			out[n++] = '\n';
+			col = 0;
+		}
+		else if (col > 0)
+		{
+			out[n++] = ' ';
+			out[n++] = ' ';
+			col += 2;
+		}
+		_memcpy(out + n, m->v[i], len);
+		n += len;
+		col += len;
+	}
+	out[n++] = '\n';
+	write(STDOUT_FILENO, out, n);
+}
+
+/**
+ * complete_insert - Inserts the part shared by all candidates.
+ * @e: The editor state.
+ * @m: The match list.
+ * @blen: The length of the word already typed.
+ *
+ * Description: Duplicates are dropped first. A unique candidate is
+ *              completed in full and followed by a space unless it is a
+ *              directory. Otherwise the longest common prefix is inserted,
+ *              and the candidates are listed when that adds nothing.
+ */
+void complete_insert(edit_t *e, match_t *m, int blen)
+{
+	int i, n, common;
+
+	qsort(m->v, m->len, sizeof(char *), match_cmp);
+	for (i = 1, n = 1; i < m->len; i++)
+	{
+		if (_strcmp(m->v[i], m->v[n - 1]) == 0)
+			free(m->v[i]);
+		else
+			m->v[n++] = m->v[i];
+	}
+	m->len = n;
+	common = _strlen(m->v[0]);
+	for (i = 1; i < m->len; i++)
+	{
+		for (n = 0; n < common && m->v[0][n] == m->v[i][n]; n++)
+			;
+		common = n;
+	}
+	if (common > blen)
+		edit_insert(e, m->v[0] + blen, common - blen);
+	if (m->len == 1 && m->v[0][common - 1] != '/')
+		edit_insert(e, " ", 1);
+	else if (m->len > 1 && common == blen)
+		complete_list(e, m);
+}
+
+/**
+ * edit_complete - Completes the word before the cursor.
+ * @e: The editor state.
+ *
+ * Description: The first word of a command is completed from the
+ *              builtins, the aliases and the PATH index. Any other word,
+ *              or one containing '/', is completed from the file system.
+ */
+void edit_complete(edit_t *e)
+{
+	match_t m;
+	int start = e->pos, prev, base, i, len;
+
+	_memset(&m, 0, sizeof(m));
+	while (start > 0 && e->buf[start - 1] != ' ')
+		start--;
+	for (prev = start; prev > 0 && e->buf[prev - 1] == ' '; prev--)
+		;
+	for (base = start, i = start; i < e->pos; i++)
+		if (e->buf[i] == '/')
+			base = i + 1;
+	len = e->pos - start;
+	if (base == start && (prev == 0 || _strchr(";&|", e->buf[prev - 1])))
+		complete_commands(e->buf + start, len, &m);
+	else
+		complete_files(e->buf + start, len, base - start, &m);
+	if (m.len == 0)
+		write(STDOUT_FILENO, "\a", 1);
+	else
+		complete_insert(e, &m, e->pos - base);
+	for (i = 0; i < m.len; i++)
+		free(m.v[i]);
+	free(m.v);
+}
@@ -0,0 +1,49 @@
+#include "shell.h"
+
+int complete_files(char *word, int len, int base, match_t *m);
+
+/**
+ * complete_files - Collects the file names that complete a word.
+ * @word: The word being completed.
+ * @len: The length of word.
+ * @base: The index in word just past its last '/', or 0.
+ * @m: The match list to fill.
+ *
+ * Return: If the directory cannot be read - -1.
+ *         Otherwise - 0.
+ *
+ * Description: Directories get a trailing '/'. Names starting with '.'
+ *              are only offered when the typed name starts with '.'.
+ */
+int complete_files(char *word, int len, int base, match_t *m)
+{
+	char dir[EDIT_MAX];
+	struct dirent *ent;
+	struct stat st;
+	DIR *dp;
+	int is_dir;
+
+	_memcpy(dir, word, base);
+	dir[base] = '\0';
+	if (base == 0)
+		_strcpy(dir, ".");
+	dp = opendir(dir);
+	if (!dp)
+		return (-1);
+	while ((ent = readdir(dp)) != NULL)
+	{
+		if (_strncmp(ent->d_name, word + base, len - base) != 0 ||
+				(ent->d_name[0] == '.' && word[base] != '.') ||
+				_strcmp(ent->d_name, ".") == 0 ||
+				_strcmp(ent->d_name, "..") == 0)
+			continue;
+		is_dir = ent->d_type == DT_DIR;
+		if ((ent->d_type == DT_UNKNOWN || ent->d_type == DT_LNK) &&
+				fstatat(dirfd(dp), ent->d_name, &st, 0) == 0)
+			is_dir = S_ISDIR(st.st_mode);
+		match_add(m, ent->d_name, _strlen(ent->d_name),
+				is_dir ? '/' : '\0');
+	}
+	closedir(dp);
+	return (0);
+}
@@ -0,0 +1,106 @@
+#include "shell.h"
+
+int shellby_echo(char **args, char __attribute__((__unused__)) **front);
+int esc_char(char *s, char *c, int zero);
+size_t esc_expand(char *s, char *out, int zero, int *stop);
+
+/**
+ * shellby_echo - Writes its arguments to standard output.
+ * @args: An array of arguments.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: Always 0.
+ *
+ * Description: Backslash escapes are interpreted as XSI echo does, and a
+ *              first argument of "-n" drops the trailing newline. The
+ *              output goes through the builtin output buffer.
+ */
+int shellby_echo(char **args, char __attribute__((__unused__)) **front)
+{
+	int i = 0, first, stop = 0;
+	size_t len;
+
+	if (args[0] && _strcmp(args[0], "-n") == 0)
+		i = 1;
+	for (first = i; args[i] && !stop; i++)
+	{
+		if (i > first)
+			out_write(" ", 1);
+		len = esc_expand(args[i], args[i], 1, &stop);
+		out_write(args[i], len);
+	}
+	if (!first && !stop)
+		out_write("\n", 1);
+	return (0);
+}
+
+/**
+ * esc_char - Decodes one backslash escape sequence.
+ * @s: The text just after the backslash.
+ * @c: Where to store the decoded byte.
+ * @zero: Non-zero if octal escapes are written \0NNN (echo and %b),
+ *        zero if they are written \NNN (printf formats).
+ *
+ * Return: If the escape is \c - -1.
+ *         Otherwise - the number of bytes of s consumed, 0 when the
+ *         backslash does not start an escape and stands for itself.
+ */
+int esc_char(char *s, char *c, int zero)
+{
+	char *from = "\\abfnrtv", *to = "\\\a\b\f\n\r\t\v";
+	int i, n;
+
+	if (*s == 'c')
+		return (-1);
+	for (i = 0; from[i]; i++)
+	{
+		if (*s == from[i])
+		{
+			*c = to[i];
+			return (1);
+		}
+	}
+	i = zero && *s == '0';
+	if (!i && (zero || *s < '0' || *s > '7'))
+	{
+		*c = '\\';
+		return (0);
+	}
+	for (*c = 0, n = 0; n < 3 && s[i] >= '0' && s[i] <= '7'; n++, i++)
+		*c = *c * 8 + (s[i] - '0');
+	return (i);
+}
+
+/**
+ * esc_expand - Decodes the backslash escapes of a string.
+ * @s: The string.
+ * @out: Where to write the result. It may be s itself, since the
+ *       result is never longer than the input.
+ * @zero: Passed on to esc_char.
+ * @stop: Set to 1 if a \c ended the string early.
+ *
+ * Return: The length of the result.
+ */
+size_t esc_expand(char *s, char *out, int zero, int *stop)
+{
+	size_t len = 0;
+	int n;
+
+	while (*s)
+	{
+		if (*s != '\\')
+		{
+			out[len++] = *s++;
+			continue;
+		}
+		n = esc_char(s + 1, out + len, zero);
+		if (n == -1)
+		{
+			*stop = 1;
+			break;
+		}
+		len++;
+		s += n + 1;
+	}
+	return (len);
+}
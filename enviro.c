@@ -3,54 +3,69 @@
 char **_copyenv(void);
 void free_env(void);
 char **_getenv(const char *var);
+int env_set(char **env_var, char *value);
+int env_remove(char **env_var);
+
+static char *env_own;
+static size_t env_len, env_cap;
 
 /**
- * _copyenv - Creates a copy of the environment.
+ * _copyenv - Makes the environment writable by copying its pointer vector.
  *
  * Return: If an error occurs - NULL.
  *         O/w - a double pointer to the new copy.
+ *
+ * Description: The variable strings themselves are shared with the
+ *              inherited environment. An entry is only copied when it is
+ *              modified, which env_own records per index.
  */
 char **_copyenv(void)
 {
 	char **new_environ;
-	size_t size;
-	int index;
+	size_t index;
 
-	for (size = 0; environ[size]; size++)
+	if (env_own)
+		return (environ);
+	for (env_len = 0; environ[env_len]; env_len++)
 		;
+	env_cap = env_len + 8;
 
-	new_environ = malloc(sizeof(char *) * (size + 1));
-	if (!new_environ)
-		return (NULL);
-
-	for (index = 0; environ[index]; index++)
+	new_environ = malloc(sizeof(char *) * (env_cap + 1));
+	env_own = malloc(env_cap);
+	if (!new_environ || !env_own)
 	{
-		new_environ[index] = malloc(_strlen(environ[index]) + 1);
-
-		if (!new_environ[index])
-		{
-			for (index--; index >= 0; index--)
-				free(new_environ[index]);
-			free(new_environ);
-			return (NULL);
-		}
-		_strcpy(new_environ[index], environ[index]);
+		free(new_environ);
+		free(env_own);
+		env_own = NULL;
+		return (NULL);
 	}
-	new_environ[index] = NULL;
+
+	for (index = 0; index <= env_len; index++)
+		new_environ[index] = environ[index];
+	for (index = 0; index < env_cap; index++)
+		env_own[index] = 0;
+	environ = new_environ;
 
 	return (new_environ);
 }
 
 /**
- * free_env - Frees the the environment copy.
+ * free_env - Frees the the environment copy, if one was made.
  */
 void free_env(void)
 {
-	int index;
+	size_t index;
 
-	for (index = 0; environ[index]; index++)
-		free(environ[index]);
+	if (!env_own)
+		return;
+	for (index = 0; index < env_len; index++)
+	{
+		if (env_own[index])
+			free(environ[index]);
+	}
 	free(environ);
+	free(env_own);
+	env_own = NULL;
 }
 
 /**
@@ -67,9 +82,89 @@ char **_getenv(const char *var)
 	len = _strlen(var);
 	for (index = 0; environ[index]; index++)
 	{
-		if (_strncmp(var, environ[index], len) == 0)
+		if (_strncmp(var, environ[index], len) == 0 &&
+		    environ[index][len] == '=')
 			return (&environ[index]);
 	}
 
 	return (NULL);
 }
+
+/**
+ * env_set - Replaces or appends an environment entry.
+ * @env_var: The entry to replace, as returned by _getenv, or NULL to append.
+ * @value: The new malloc'd "NAME=VALUE" string. The environment owns it.
+ *
+ * Return: If an error occurs - -1.
+ *         Otherwise - 0.
+ *
+ * Description: Changing PATH or PWD advances path_gen, which makes the
+ *              command lookup cache reread the PATH directories.
+ */
+int env_set(char **env_var, char *value)
+{
+	size_t index = env_var ? (size_t)(env_var - environ) : 0;
+	char **new_environ, *new_own;
+
+	if (!_copyenv())
+		return (-1);
+	if (_strncmp(value, "PATH=", 5) == 0 || _strncmp(value, "PWD=", 4) == 0)
+		path_gen++;
+	if (env_var)
+	{
+		if (env_own[index])
+			free(environ[index]);
+		environ[index] = value;
+		env_own[index] = 1;
+		return (0);
+	}
+	if (env_len == env_cap)
+	{
+		new_environ = malloc(sizeof(char *) * (env_cap * 2 + 1));
+		new_own = malloc(env_cap * 2);
+		if (!new_environ || !new_own)
+		{
+			free(new_environ);
+			free(new_own);
+			return (-1);
+		}
+		_memcpy(new_environ, environ, sizeof(char *) * env_len);
+		_memcpy(new_own, env_own, env_len);
+		free(environ);
+		free(env_own);
+		environ = new_environ;
+		env_own = new_own;
+		env_cap *= 2;
+	}
+	environ[env_len] = value;
+	env_own[env_len++] = 1;
+	environ[env_len] = NULL;
+	return (0);
+}
+
+/**
+ * env_remove - Removes an environment entry.
+ * @env_var: The entry to remove, as returned by _getenv.
+ *
+ * Return: If an error occurs - -1.
+ *         Otherwise - 0.
+ */
+int env_remove(char **env_var)
+{
+	size_t index = env_var - environ;
+
+	if (!_copyenv())
+		return (-1);
+	if (_strncmp(environ[index], "PATH=", 5) == 0 ||
+	    _strncmp(environ[index], "PWD=", 4) == 0)
+		path_gen++;
+	if (env_own[index])
+		free(environ[index]);
+	for (env_len--; index < env_len; index++)
+	{
+		environ[index] = environ[index + 1];
+		env_own[index] = env_own[index + 1];
+	}
+	environ[env_len] = NULL;
+	return (0);
+}
@@ -17,16 +17,19 @@ int shellby_unsetenv(char **args, char __attribute__((__unused__)) **front);
  */
 int shellby_env(char **args, char __attribute__((__unused__)) **front)
 {
+	struct iovec iov[2];
 	int index;
-	char nc = '\n';
 
 	if (!environ)
 		return (-1);
 
+	iov[1].iov_base = "\n";
 	for (index = 0; environ[index]; index++)
 	{
-		write(STDOUT_FILENO, environ[index], _strlen(environ[index]));
-		write(STDOUT_FILENO, &nc, 1);
+		iov[0].iov_base = environ[index];
+		iov[0].iov_len = _strlen(environ[index]);
+		iov[1].iov_len = 1;
+		out_writev(iov, 2);
 	}
 
 	(void)args;
@@ -45,45 +48,28 @@ int shellby_env(char **args, char __attribute__((__unused__)) **front)
  */
 int shellby_setenv(char **args, char __attribute__((__unused__)) **front)
 {
-	char **env_var = NULL, **new_environ, *new_value;
-	size_t size;
-	int index;
+	char **env_var = NULL, *new_value;
+	int name_len, value_len;
 
 	if (!args[0] || !args[1])
 		return (create_error(args, -1));
 
-	new_value = malloc(_strlen(args[0]) + 1 + _strlen(args[1]) + 1);
+	name_len = _strlen(args[0]);
+	value_len = _strlen(args[1]);
+	new_value = malloc(name_len + 1 + value_len + 1);
 	if (!new_value)
 		return (create_error(args, -1));
-	_strcpy(new_value, args[0]);
-	_strcat(new_value, "=");
-	_strcat(new_value, args[1]);
+	_memcpy(new_value, args[0], name_len);
+	new_value[name_len] = '=';
+	_memcpy(new_value + name_len + 1, args[1], value_len + 1);
 
 	env_var = _getenv(args[0]);
-	if (env_var)
-	{
-		free(*env_var);
-		*env_var = new_value;
-		return (0);
-	}
-	for (size = 0; environ[size]; size++)
-		;
-
-	new_environ = malloc(sizeof(char *) * (size + 2));
-	if (!new_environ)
+	if (env_set(env_var, new_value) == -1)
 	{
 		free(new_value);
 		return (create_error(args, -1));
 	}
 
-	for (index = 0; environ[index]; index++)
-		new_environ[index] = environ[index];
-
-	free(environ);
-	environ = new_environ;
-	environ[index] = new_value;
-	environ[index + 1] = NULL;
-
 	return (0);
 }
 
@@ -98,9 +84,7 @@ int shellby_setenv(char **args, char __attribute__((__unused__)) **front)
  */
 int shellby_unsetenv(char **args, char __attribute__((__unused__)) **front)
 {
-	char **env_var, **new_environ;
-	size_t size;
-	int index, index2;
+	char **env_var;
 
 	if (!args[0])
 		return (create_error(args, -1));
@@ -108,26 +92,8 @@ int shellby_unsetenv(char **args, char __attribute__((__unused__)) **front)
 	if (!env_var)
 		return (0);
 
-	for (size = 0; environ[size]; size++)
-		;
-
-	new_environ = malloc(sizeof(char *) * size);
-	if (!new_environ)
+	if (env_remove(env_var) == -1)
 		return (create_error(args, -1));
 
-	for (index = 0, index2 = 0; environ[index]; index++)
-	{
-		if (*env_var == environ[index])
-		{
-			free(*env_var);
-			continue;
-		}
-		new_environ[index2] = environ[index];
-		index2++;
-	}
-	free(environ);
-	environ = new_environ;
-	environ[size - 1] = NULL;
-
 	return (0);
 }
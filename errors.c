@@ -1,6 +1,7 @@
 #include "shell.h"
 
 int num_len(int num);
+int _itoa_buf(long num, char *buffer);
 char *_itoa(int num);
 int create_error(char **args, int err);
 
@@ -34,43 +35,56 @@ int num_len(int num)
 }
 
 /**
- * _itoa - Converts an integer to a string.
+ * _itoa_buf - Converts an integer to a string in a caller-supplied buffer.
  * @num: The integer.
+ * @buffer: The buffer to fill. Must hold at least 21 bytes.
  *
- * Return: The converted string.
+ * Return: The length of the converted string.
  */
-char *_itoa(int num)
+int _itoa_buf(long num, char *buffer)
 {
-	char *buffer;
-	int len = num_len(num);
-	unsigned int num1;
-
-	buffer = malloc(sizeof(char) * (len + 1));
-	if (!buffer)
-		return (NULL);
-
-	buffer[len] = '\0';
+	char digits[20];
+	unsigned long num1;
+	int len = 0, i = 0;
 
 	if (num < 0)
 	{
-		num1 = num * -1;
-		buffer[0] = '-';
+		num1 = -(unsigned long)num;
+		buffer[len++] = '-';
 	}
 	else
 	{
 		num1 = num;
 	}
 
-	len--;
 	do {
-		buffer[len] = (num1 % 10) + '0';
+		digits[i++] = (num1 % 10) + '0';
 		num1 /= 10;
-		len--;
 	} while (num1 > 0);
+	while (i > 0)
+		buffer[len++] = digits[--i];
+	buffer[len] = '\0';
 
-	return (buffer);
+	return (len);
 }
 
+/**
+ * _itoa - Converts an integer to a string.
+ * @num: The integer.
+ *
+ * Return: The converted string.
+ */
+char *_itoa(int num)
+{
+	char *buffer;
+
+	buffer = malloc(sizeof(char) * (num_len(num) + 1));
+	if (!buffer)
+		return (NULL);
+
+	_itoa_buf(num, buffer);
+	return (buffer);
+}
 
 /**
  * create_error - Writes a custom error message to stderr.
@@ -81,35 +95,31 @@ char *_itoa(int num)
  */
 int create_error(char **args, int err)
 {
-	char *error;
-
 	switch (err)
 	{
 	case -1:
-		error = error_env(args);
+		print_error(ERR_ENV, args[-1]);
 		break;
 	case 1:
-		error = error_1(args);
+		print_error(ERR_ALIAS, args[0]);
 		break;
 	case 2:
 		if (*(args[0]) == 'e')
-			error = error_2_exit(++args);
+			print_error(ERR_EXIT, args[1]);
 		else if (args[0][0] == ';' || args[0][0] == '&' || args[0][0] == '|')
-			error = error_2_syntax(args);
+			print_error(ERR_SYNTAX, args[0]);
+		else if (args[0][0] == '-')
+			print_error(ERR_CD_OPT, args[0]);
 		else
-			error = error_2_cd(args);
+			print_error(ERR_CD, args[0]);
 		break;
 	case 126:
-		error = error_126(args);
+		print_error(ERR_PERM, args[0]);
 		break;
 	case 127:
-		error = error_127(args);
+		print_error(ERR_NOT_FOUND, args[0]);
 		break;
 	}
-	write(STDERR_FILENO, error, _strlen(error));
 
-	if (error)
-		free(error);
 	return (err);
-
 }
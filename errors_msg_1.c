@@ -1,171 +1,80 @@
 #include "shell.h"
 
-char *error_env(char **args);
-char *error_1(char **args);
-char *error_2_exit(char **args);
-char *error_2_cd(char **args);
-char *error_2_syntax(char **args);
-/**
- * error_env - Creates an error message for shellby_env errors.
- * @args: An array of arguments passed to the command.
- *
- * Return: The error string.
- */
-char *error_env(char **args)
-{
-	char *error, *hist_str;
-	int len;
-
-	hist_str = _itoa(hist);
-	if (!hist_str)
-		return (NULL);
-
-	args--;
-	len = _strlen(name) + _strlen(hist_str) + _strlen(args[0]) + 45;
-	error = malloc(sizeof(char) * (len + 1));
-	if (!error)
-	{
-		free(hist_str);
-		return (NULL);
-	}
-
-	_strcpy(error, name);
-	_strcat(error, ": ");
-	_strcat(error, hist_str);
-	_strcat(error, ": ");
-	_strcat(error, args[0]);
-	_strcat(error, ": Unable to add/remove from environment\n");
-
-	free(hist_str);
-	return (error);
-}
-
-/**
- * error_1 - Creates an error message for shellby_alias errors.
- * @args: An array of arguments passed to the command.
- *
- * Return: The error string.
- */
-char *error_1(char **args)
-{
-	char *error;
-	int len;
-
-	len = _strlen(name) + _strlen(args[0]) + 13;
-	error = malloc(sizeof(char) * (len + 1));
-	if (!error)
-		return (NULL);
-
-	_strcpy(error, "alias: ");
-	_strcat(error, args[0]);
-	_strcat(error, " not found\n");
-
-	return (error);
-}
-
-/**
- * error_2_exit - Creates an error message for shellby_exit errors.
- * @args: An array of arguments passed to the command.
- *
- * Return: The error string.
- */
-char *error_2_exit(char **args)
-{
-	char *error, *hist_str;
-	int len;
-
-	hist_str = _itoa(hist);
-	if (!hist_str)
-		return (NULL);
-
-	len = _strlen(name) + _strlen(hist_str) + _strlen(args[0]) + 27;
-	error = malloc(sizeof(char) * (len + 1));
-	if (!error)
-	{
-		free(hist_str);
-		return (NULL);
-	}
-
-	_strcpy(error, name);
-	_strcat(error, ": ");
-	_strcat(error, hist_str);
-	_strcat(error, ": exit: Illegal number: ");
-	_strcat(error, args[0]);
-	_strcat(error, "\n");
-
-	free(hist_str);
-	return (error);
-}
+int print_error(int id, char *arg);
+
+static const err_msg_t msgs[] = {
+	{ 1, 0, ": ", ": Unable to add/remove from environment\n" },
+	{ 0, 0, "alias: ", " not found\n" },
+	{ 1, 0, ": exit: Illegal number: ", "\n" },
+	{ 1, 0, ": cd: can't cd to ", "\n" },
+	{ 1, 2, ": cd: Illegal option ", "\n" },
+	{ 1, 0, ": Syntax error: \"", "\" unexpected\n" },
+	{ 1, 0, ": ", ": Permission denied\n" },
+	{ 1, 0, ": ", ": not found\n" },
+	{ 1, 0, ": Can't open ", "\n" },
+	{ 1, 0, ": ", " requires an argument\n" },
+	{ 1, 0, ": history: Illegal number: ", "\n" },
+	{ 1, 0, ": limit: Illegal option or value for ", "\n" },
+	{ 1, 0, ": limit: Cannot limit \"", "\": need a program\n" },
+	{ 1, 0, ": printf: usage: printf format [arg ...]", "\n" },
+	{ 1, 0, ": printf: %", ": invalid directive\n" },
+	{ 1, 0, ": printf: ", ": expected numeric value\n" },
+	{ 1, 0, ": printf: ", ": not completely converted\n" },
+	{ 1, 0, ": test: ", ": unexpected operator\n" },
+	{ 1, 0, ": test: Illegal number: ", "\n" },
+	{ 1, 0, ": test: argument expected", "\n" },
+	{ 1, 0, ": [: missing ]", "\n" },
+	{ 1, 0, ": test: closing paren expected", "\n" },
+	{ 1, 0, ": arithmetic expression: syntax error: \"", "\"\n" },
+	{ 1, 0, ": arithmetic expression: division by zero", "\n" },
+	{ 1, 0, ": Illegal number: ", "\n" },
+	{ 1, 0, ": break: Illegal number: ", "\n" },
+	{ 1, 0, ": continue: Illegal number: ", "\n" },
+	{ 1, 0, ": return: Illegal number: ", "\n" },
+	{ 1, 0, ": local: not in a function", "\n" },
+	{ 1, 0, ": local: ", ": bad variable name\n" },
+	{ 1, 0, ": ", ": Argument list too long\n" },
+	{ 1, 0, ": xargs: Illegal option or number: ", "\n" },
+	{ 1, 0, ": printf: ", ": Numerical result out of range\n" },
+	{ 1, 0, ": Syntax error: Missing '))'", "\n" }
+};
 
 /**
- * error_2_cd - Creates an error message for shellby_cd errors.
- * @args: An array of arguments passed to the command.
+ * print_error - Writes an error message from the message table to stderr.
+ * @id: The ERR_* index of the message template.
+ * @arg: The offending argument to embed in the message.
  *
- * Return: The error string.
- */
-char *error_2_cd(char **args)
-{
-	char *error, *hist_str;
-	int len;
-
-	hist_str = _itoa(hist);
-	if (!hist_str)
-		return (NULL);
-
-	if (args[0][0] == '-')
-		args[0][2] = '\0';
-	len = _strlen(name) + _strlen(hist_str) + _strlen(args[0]) + 24;
-	error = malloc(sizeof(char) * (len + 1));
-	if (!error)
-	{
-		free(hist_str);
-		return (NULL);
-	}
-
-	_strcpy(error, name);
-	_strcat(error, ": ");
-	_strcat(error, hist_str);
-	if (args[0][0] == '-')
-		_strcat(error, ": cd: Illegal option ");
-	else
-		_strcat(error, ": cd: can't cd to ");
-	_strcat(error, args[0]);
-	_strcat(error, "\n");
-
-	free(hist_str);
-	return (error);
-}
-
-/**
- * error_2_syntax - Creates an error message for syntax errors.
- * @args: An array of arguments passed to the command.
+ * Return: The number of bytes written, or -1 on failure.
  *
- * Return: The error string.
+ * Description: The message is assembled on the stack and written with a
+ *              single writev call, so the error path never allocates.
+ *              Pending builtin output is flushed first to keep ordering.
  */
-char *error_2_syntax(char **args)
+int print_error(int id, char *arg)
 {
-	char *error, *hist_str;
-	int len;
-
-	hist_str = _itoa(hist);
-	if (!hist_str)
-		return (NULL);
+	const err_msg_t *msg = &msgs[id];
+	struct iovec iov[6];
+	char hist_str[24];
+	int n = 0, len = _strlen(arg);
 
-	len = _strlen(name) + _strlen(hist_str) + _strlen(args[0]) + 33;
-	error = malloc(sizeof(char) * (len + 1));
-	if (!error)
+	out_flush();
+	if (msg->head)
 	{
-		free(hist_str);
-		return (NULL);
+		iov[n].iov_base = name;
+		iov[n++].iov_len = _strlen(name);
+		iov[n].iov_base = ": ";
+		iov[n++].iov_len = 2;
+		iov[n].iov_base = hist_str;
+		iov[n++].iov_len = _itoa_buf(hist, hist_str);
 	}
-
-	_strcpy(error, name);
-	_strcat(error, ": ");
-	_strcat(error, hist_str);
-	_strcat(error, ": Syntax error: \"");
-	_strcat(error, args[0]);
-	_strcat(error, "\" unexpected\n");
-
-	free(hist_str);
-	return (error);
+	if (msg->arg_len && len > msg->arg_len)
+		len = msg->arg_len;
+	iov[n].iov_base = msg->pre;
+	iov[n++].iov_len = _strlen(msg->pre);
+	iov[n].iov_base = arg;
+	iov[n++].iov_len = len;
+	iov[n].iov_base = msg->post;
+	iov[n++].iov_len = _strlen(msg->post);
+
+	return (writev(STDERR_FILENO, iov, n));
 }
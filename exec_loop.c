@@ -0,0 +1,139 @@
+#include "shell.h"
+
+int exec_loop(node_t *n, int *exe_ret);
+int exec_for(node_t *n, int *exe_ret);
+int exec_case(node_t *n, int *exe_ret, int tail);
+int loop_leave(void);
+
+/**
+ * exec_loop - Runs a while or until loop.
+ * @n: The loop.
+ * @exe_ret: The return value of the last executed command.
+ *
+ * Return: The return value of the last command of the body, or 0 if the
+ *         body never ran.
+ *
+ * Description: The test builtin's stat cache is dropped on every pass,
+ *              so a loop waiting for a file sees it appear.
+ */
+int exec_loop(node_t *n, int *exe_ret)
+{
+	int ret = 0, status = 0;
+
+	loop_depth++;
+	while (1)
+	{
+		stat_cache_reset();
+		ret = exec_list(n->a, exe_ret, 0);
+		if (ret == EXIT || ((loop_break || loop_cont) && loop_leave()))
+			break;
+		if ((*exe_ret == 0) != (n->type == N_WHILE))
+			break;
+		ret = exec_list(n->b, exe_ret, 0);
+		status = *exe_ret;
+		if (ret == EXIT || ((loop_break || loop_cont) && loop_leave()))
+			break;
+	}
+	loop_depth--;
+	if (ret != EXIT)
+		ret = *exe_ret = status;
+	return (ret);
+}
+
+/**
+ * exec_for - Runs a for loop.
+ * @n: The loop.
+ * @exe_ret: The return value of the last executed command.
+ *
+ * Return: The return value of the last command of the body, or 0 if the
+ *         body never ran.
+ *
+ * Description: The words are expanded once, before the first pass.
+ *              Without "in", the loop runs over the positional parameters.
+ */
+int exec_for(node_t *n, int *exe_ret)
+{
+	char **list, **items;
+	int i, ret = 0, status = 0;
+
+	list = n->words ? expand_words(n->words, 1, exe_ret) : NULL;
+	if (n->words && !list)
+		return (*exe_ret = 2);
+	items = n->words ? list : pos_args;
+	loop_depth++;
+	for (i = 0; items && items[i]; i++)
+	{
+		if (var_set(n->name, items[i]) == -1)
+		{
+			status = 1;
+			break;
+		}
+		stat_cache_reset();
+		ret = exec_list(n->b, exe_ret, 0);
+		status = *exe_ret;
+		if (ret == EXIT || ((loop_break || loop_cont) && loop_leave()))
+			break;
+	}
+	loop_depth--;
+	if (list)
+		free_args(list, list);
+	if (ret != EXIT)
+		ret = *exe_ret = status;
+	return (ret);
+}
+
+/**
+ * exec_case - Runs a case command.
+ * @n: The command.
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing runs after this command.
+ *
+ * Return: The return value of the item that ran, or 0 if none did.
+ *
+ * Description: Patterns are expanded and tried in order, and only until
+ *              one matches.
+ */
+int exec_case(node_t *n, int *exe_ret, int tail)
+{
+	node_t *item;
+	char *word, *pat;
+	int i, match = 0;
+
+	word = expand_word(n->name, exe_ret);
+	if (!word)
+		return (*exe_ret = 2);
+	for (item = n->c; item; item = item->next)
+	{
+		for (i = 0; item->words[i] && !match; i++)
+		{
+			pat = expand_word(item->words[i], exe_ret);
+			match = pat ? pattern_match(pat, word) : -1;
+			free(pat);
+		}
+		if (match)
+			break;
+	}
+	free(word);
+	if (match == -1)
+		return (*exe_ret = 2);
+	if (!item || !item->b)
+		return (*exe_ret = 0);
+	return (exec_list(item->b, exe_ret, tail));
+}
+
+/**
+ * loop_leave - Handles a pending break or continue at the end of a pass
+ *              of a loop.
+ *
+ * Return: 1 if the loop must stop, or 0 if it goes on to its next pass.
+ */
+int loop_leave(void)
+{
+	if (loop_break)
+	{
+		loop_break--;
+		return (1);
+	}
+	loop_cont = 0;
+	return (0);
+}
@@ -0,0 +1,178 @@
+#include "shell.h"
+
+int exec_list(node_t *n, int *exe_ret, int tail);
+int exec_node(node_t *n, int *exe_ret, int tail);
+int exec_simple(char **words, int *exe_ret, int tail);
+int exec_if(node_t *n, int *exe_ret, int tail);
+int exec_assign(char **words, int *exe_ret);
+
+/**
+ * exec_list - Runs a list of parsed commands.
+ * @n: The first command, or NULL.
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing runs after this list, so that its final
+ *        command may replace the shell instead of forking.
+ *
+ * Return: The return value of the last executed command.
+ *
+ * Description: The list stops early on exit, break, continue and return.
+ */
+int exec_list(node_t *n, int *exe_ret, int tail)
+{
+	int ret = *exe_ret;
+
+	for (; n; n = n->next)
+	{
+		ret = exec_node(n, exe_ret, tail && !n->next);
+		if (ret == EXIT || loop_break || loop_cont || func_return)
+			break;
+	}
+	return (ret);
+}
+
+/**
+ * exec_node - Runs one parsed command.
+ * @n: The command.
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing runs after this command.
+ *
+ * Return: The return value of the command.
+ */
+int exec_node(node_t *n, int *exe_ret, int tail)
+{
+	int ret;
+
+	if (n->type == N_CMD && n->name)
+		return (heredoc_exec(n, exe_ret, tail));
+	if (n->type == N_CMD)
+		return (exec_simple(n->words, exe_ret, tail));
+	if (n->type == N_AND || n->type == N_OR)
+	{
+		ret = exec_node(n->a, exe_ret, 0);
+		if (ret == EXIT || loop_break || loop_cont || func_return ||
+		    (*exe_ret == 0) != (n->type == N_AND))
+			return (ret);
+		return (exec_node(n->b, exe_ret, tail));
+	}
+	if (n->type == N_NOT)
+	{
+		ret = exec_node(n->a, exe_ret, 0);
+		if (ret != EXIT)
+			ret = *exe_ret = !*exe_ret;
+		return (ret);
+	}
+	if (n->type == N_IF)
+		return (exec_if(n, exe_ret, tail));
+	if (n->type == N_FOR)
+		return (exec_for(n, exe_ret));
+	if (n->type == N_CASE)
+		return (exec_case(n, exe_ret, tail));
+	if (n->type == N_GROUP)
+		return (exec_list(n->a, exe_ret, tail));
+	if (n->type == N_FUNC)
+		return (*exe_ret = func_define(n->name, n->a) == -1);
+	return (exec_loop(n, exe_ret));
+}
+
+/**
+ * exec_simple - Expands and runs a simple command.
+ * @words: The words of the command, as written.
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing runs after this command.
+ *
+ * Return: The return value of the command.
+ *
+ * Description: A command made only of NAME=VALUE words sets those
+ *              variables. Otherwise the expanded words are split at
+ *              spaces, aliases are replaced and the function, builtin
+ *              or program named by the first word is run.
+ */
+int exec_simple(char **words, int *exe_ret, int tail)
+{
+	char **args;
+	node_t *body;
+	int i, len, ret;
+
+	for (i = 0; words[i]; i++)
+	{
+		len = name_len(words[i]);
+		if (!len || words[i][len] != '=')
+			break;
+	}
+	if (!words[i])
+		return (exec_assign(words, exe_ret));
+	args = expand_words(words, 1, exe_ret);
+	if (!args)
+	{
+		hist++;
+		return (*exe_ret = 2);
+	}
+	if (!args[0])
+	{
+		free(args);
+		return (*exe_ret);
+	}
+	args = replace_aliases(args);
+	if (!args)
+		return (-1);
+	body = func_find(args[0]);
+	if (body)
+		return (func_call(body, args, exe_ret));
+	tail_exec = tail;
+	ret = run_args(args, args, exe_ret);
+	tail_exec = 0;
+	free(args);
+	return (ret);
+}
+
+/**
+ * exec_if - Runs an if command.
+ * @n: The command.
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing runs after this command.
+ *
+ * Return: The return value of the branch that ran, or 0 if none did.
+ */
+int exec_if(node_t *n, int *exe_ret, int tail)
+{
+	int ret = exec_list(n->a, exe_ret, 0);
+
+	if (ret == EXIT || loop_break || loop_cont || func_return)
+		return (ret);
+	if (*exe_ret == 0)
+		return (exec_list(n->b, exe_ret, tail));
+	if (n->c)
+		return (exec_list(n->c, exe_ret, tail));
+	return (*exe_ret = 0);
+}
+
+/**
+ * exec_assign - Sets variables from NAME=VALUE words.
+ * @words: The words, as written.
+ * @exe_ret: The return value of the last executed command.
+ *
+ * Return: 0 on success, 1 if a variable could not be set, or 2 if an
+ *         expansion failed. On success, the return value of the last
+ *         command substitution in the values, if any.
+ *
+ * Description: Each word is expanded and assigned in turn, so a value
+ *              can use the variables set before it.
+ */
+int exec_assign(char **words, int *exe_ret)
+{
+	char *word;
+	int i, ret = 0;
+
+	hist++;
+	cmdsub_status = -1;
+	for (i = 0; words[i]; i++)
+	{
+		word = expand_word(words[i], exe_ret);
+		if (!word)
+			return (*exe_ret = 2);
+		ret |= var_assign(word);
+	}
+	if (!ret && cmdsub_status != -1)
+		return (*exe_ret = cmdsub_status);
+	return (*exe_ret = ret != 0);
+}
@@ -0,0 +1,146 @@
+#include "shell.h"
+
+char *expand_word(char *word, int *exe_ret);
+char **expand_words(char **words, int split, int *exe_ret);
+int expand_split(argv_t *av, char *s);
+int var_assign(char *word);
+int var_set(char *var, char *value);
+
+/**
+ * expand_word - Expands the parameters and arithmetic in a word.
+ * @word: The word, as written.
+ * @exe_ret: The return value of the last executed command, for $?.
+ *
+ * Return: The expanded word, or NULL if an expansion failed (an error
+ *         is printed and $? is set to 2) or memory ran out.
+ */
+char *expand_word(char *word, int *exe_ret)
+{
+	char *s = malloc(_strlen(word) + 1);
+
+	if (!s)
+		return (NULL);
+	_strcpy(s, word);
+	if (_strchr(s, '$') && variable_replacement(&s, exe_ret) == -1)
+	{
+		free(s);
+		return (NULL);
+	}
+	return (s);
+}
+
+/**
+ * expand_words - Expands the words of a command.
+ * @words: The words, as written.
+ * @split: Non-zero to expand braces, split expanded words at blanks and
+ *         newlines and expand pathname patterns. Words that expand to
+ *         nothing are then dropped.
+ * @exe_ret: The return value of the last executed command, for $?.
+ *
+ * Return: The expanded words, terminated by two NULL entries the way
+ *         free_args expects, or NULL if an expansion failed.
+ */
+char **expand_words(char **words, int split, int *exe_ret)
+{
+	argv_t av = {NULL, 0, 2};
+	char **src = split ? brace_words(words) : words, *s;
+	int i, ret = 0;
+
+	av.v = malloc(sizeof(char *) * 2);
+	if (av.v)
+		av.v[0] = av.v[1] = NULL;
+	for (i = 0; av.v && src && src[i] && ret != -1; i++)
+	{
+		s = expand_word(src[i], exe_ret);
+		if (s && split && _strchr(src[i], '$'))
+			ret = expand_split(&av, s);
+		else
+			ret = argv_push(&av, s);
+	}
+	if (src && src != words)
+		free_args(src, src);
+	if (av.v && (!src || ret == -1))
+	{
+		free_args(av.v, av.v);
+		return (NULL);
+	}
+	return (split && av.v ? glob_words(av.v) : av.v);
+}
+
+/**
+ * expand_split - Splits an expanded word at blanks and newlines into
+ *                separate words.
+ * @av: The vector of expanded words the fields are added to.
+ * @s: The expanded word. It is freed or added to av.
+ *
+ * Return: 0 on success, or -1 if memory ran out.
+ */
+int expand_split(argv_t *av, char *s)
+{
+	char **fields;
+	int i, blank = 0;
+
+	for (i = 0; s[i]; i++)
+	{
+		if (s[i] == '\t' || s[i] == '\n')
+			s[i] = ' ';
+		blank |= s[i] == ' ';
+	}
+	if (*s && !blank)
+		return (argv_push(av, s));
+	fields = _strtok(s, " ");
+	free(s);
+	for (i = 0; fields && fields[i]; i++)
+	{
+		if (argv_push(av, fields[i]) == -1)
+		{
+			while (fields[++i])
+				free(fields[i]);
+			free(fields);
+			return (-1);
+		}
+	}
+	free(fields);
+	return (0);
+}
+
+/**
+ * var_assign - Sets a variable from a NAME=VALUE word.
+ * @word: The word. It becomes part of the environment, or is freed if
+ *        the variable cannot be set.
+ *
+ * Return: 0 on success, or -1 on failure.
+ */
+int var_assign(char *word)
+{
+	char *eq = _strchr(word, '='), **env;
+
+	*eq = '\0';
+	env = _getenv(word);
+	*eq = '=';
+	if (env_set(env, word) == -1)
+	{
+		free(word);
+		return (-1);
+	}
+	return (0);
+}
+
+/**
+ * var_set - Sets a variable.
+ * @var: The variable name.
+ * @value: The value.
+ *
+ * Return: 0 on success, or -1 on failure.
+ */
+int var_set(char *var, char *value)
+{
+	char *word = malloc(_strlen(var) + _strlen(value) + 2);
+
+	if (!word)
+		return (-1);
+	_strcpy(word, var);
+	_strcat(word, "=");
+	_strcat(word, value);
+	return (var_assign(word));
+}
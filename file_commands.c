@@ -13,31 +13,7 @@ int proc_file_commands(char *file_path, int *exe_ret);
 
 int cant_open(char *file_path)
 {
-	char *error, *hist_str;
-	int len;
-
-	hist_str = _itoa(hist);
-	if (!hist_str)
-		return (127);
-
-	len = _strlen(name) + _strlen(hist_str) + _strlen(file_path) + 16;
-	error = malloc(sizeof(char) * (len + 1));
-	if (!error)
-	{
-		free(hist_str);
-		return (127);
-	}
-
-	_strcpy(error, name);
-	_strcat(error, ": ");
-	_strcat(error, hist_str);
-	_strcat(error, ": Can't open ");
-	_strcat(error, file_path);
-	_strcat(error, "\n");
-
-	free(hist_str);
-	write(STDERR_FILENO, error, len);
-	free(error);
+	print_error(ERR_OPEN, file_path);
 	return (127);
 }
 
@@ -50,14 +26,17 @@ int cant_open(char *file_path)
  * Return: If file couldn't be opened - 127.
  *	   If malloc fails - -1.
  *	   Otherwise the return value of the last command ran.
+ *
+ * Description: The buffer is sized from the file up front, and with the
+ *              io_uring backend the file is read in one batch of reads.
  */
 int proc_file_commands(char *file_path, int *exe_ret)
 {
-	ssize_t file, b_read, i;
+	ssize_t file, b_read;
 	unsigned int line_size = 0;
 	unsigned int old_size = 120;
-	char *line, **args, **front;
-	char buffer[120];
+	struct stat st;
+	char *line;
 	int ret;
 
 	hist = 0;
@@ -67,58 +46,27 @@ int proc_file_commands(char *file_path, int *exe_ret)
 		*exe_ret = cant_open(file_path);
 		return (*exe_ret);
 	}
-	line = malloc(sizeof(char) * old_size);
+	if (fstat(file, &st) == 0 && st.st_size >= (off_t)old_size)
+		old_size = st.st_size + 1;
+	line = malloc(sizeof(char) * (old_size + 1));
 	if (!line)
 		return (-1);
-	do {
-		b_read = read(file, buffer, 119);
-		if (b_read == 0 && line_size == 0)
-			return (*exe_ret);
-		buffer[b_read] = '\0';
-		line_size += b_read;
-		line = _realloc(line, old_size, line_size);
-		_strcat(line, buffer);
-		old_size = line_size;
-	} while (b_read);
-	for (i = 0; line[i] == '\n'; i++)
-		line[i] = ' ';
-	for (; i < line_size; i++)
-	{
-		if (line[i] == '\n')
-		{
-			line[i] = ';';
-			for (i += 1; i < line_size && line[i] == '\n'; i++)
-				line[i] = ' ';
-		}
-	}
-	variable_replacement(&line, exe_ret);
-	handle_line(&line, line_size);
-	args = _strtok(line, " ");
-	free(line);
-	if (!args)
-		return (0);
-	if (check_args(args) != 0)
+	line_size = uring_read_all(file, line, old_size - 1);
+	while ((b_read = read(file, line + line_size,
+					old_size - line_size)) > 0)
 	{
-		*exe_ret = 2;
-		free_args(args, args);
-		return (*exe_ret);
-	}
-	front = args;
-
-	for (i = 0; args[i]; i++)
-	{
-		if (_strncmp(args[i], ";", 1) == 0)
-		{
-			free(args[i]);
-			args[i] = NULL;
-			ret = call_args(args, front, exe_ret);
-			args = &args[++i];
-			i = 0;
-		}
+		line_size += b_read;
+		if (line_size < old_size)
+			continue;
+		line = _realloc(line, old_size + 1, old_size * 2 + 1);
+		if (!line)
+			return (-1);
+		old_size *= 2;
 	}
+	close(file);
+	line[line_size] = '\0';
+	ret = run_commands(line, exe_ret, 1);
 
-	ret = call_args(args, front, exe_ret);
-
-	free(front);
+	free(line);
 	return (ret);
 }
@@ -0,0 +1,103 @@
+#include "shell.h"
+
+func_t **func_slot(char *fname);
+node_t *func_find(char *fname);
+int func_define(char *fname, node_t *body);
+void func_unref(node_t *body);
+void func_free_all(void);
+
+static func_t *func_tab[FUNC_SLOTS];
+
+/**
+ * func_slot - Finds where a function is linked in the function table.
+ * @fname: The function name.
+ *
+ * Return: A pointer to the link holding the function, or to the NULL link
+ *         ending its chain if it is not defined.
+ */
+func_t **func_slot(char *fname)
+{
+	func_t **f = &func_tab[path_hash(fname) % FUNC_SLOTS];
+
+	while (*f && _strcmp((*f)->name, fname) != 0)
+		f = &(*f)->next;
+	return (f);
+}
+
+/**
+ * func_find - Looks up a function.
+ * @fname: The function name.
+ *
+ * Return: The parsed body of the function, or NULL if it is not defined.
+ */
+node_t *func_find(char *fname)
+{
+	func_t *f = *func_slot(fname);
+
+	return (f ? f->body : NULL);
+}
+
+/**
+ * func_define - Defines or redefines a function.
+ * @fname: The function name.
+ * @body: The parsed body. The table takes a reference to it, so it
+ *        outlives the commands that defined it.
+ *
+ * Return: 0 on success, or -1 if memory ran out.
+ */
+int func_define(char *fname, node_t *body)
+{
+	func_t **slot = func_slot(fname), *f = *slot;
+
+	if (!f)
+	{
+		f = malloc(sizeof(func_t));
+		if (!f)
+			return (-1);
+		f->name = malloc(_strlen(fname) + 1);
+		if (!f->name)
+		{
+			free(f);
+			return (-1);
+		}
+		_strcpy(f->name, fname);
+		f->body = NULL;
+		f->next = NULL;
+		*slot = f;
+	}
+	body->refs++;
+	func_unref(f->body);
+	f->body = body;
+	return (0);
+}
+
+/**
+ * func_unref - Drops a reference to a function body.
+ * @body: The body, or NULL. It is freed with its last reference.
+ */
+void func_unref(node_t *body)
+{
+	if (body && --body->refs == 0)
+		tree_free(body);
+}
+
+/**
+ * func_free_all - Frees every function before the shell exits.
+ */
+void func_free_all(void)
+{
+	func_t *f, *next;
+	int i;
+
+	for (i = 0; i < FUNC_SLOTS; i++)
+	{
+		for (f = func_tab[i]; f; f = next)
+		{
+			next = f->next;
+			func_unref(f->body);
+			free(f->name);
+			free(f);
+		}
+		func_tab[i] = NULL;
+	}
+}
@@ -0,0 +1,182 @@
+#include "shell.h"
+
+int func_call(node_t *body, char **args, int *exe_ret);
+int shellby_return(char **args, char __attribute__((__unused__)) **front);
+int shellby_local(char **args, char __attribute__((__unused__)) **front);
+int local_save(char *var, int len);
+void local_restore(local_t *mark);
+
+static local_t *locals;
+
+/**
+ * func_call - Runs a function.
+ * @body: The parsed body of the function.
+ * @args: The expanded words of the call, terminated by two NULL entries.
+ *        args[1] onwards become the positional parameters. They are freed.
+ * @exe_ret: The return value of the last executed command.
+ *
+ * Return: The return value of the function.
+ *
+ * Description: The body is run as parsed, holding a reference so that it
+ *              survives being redefined by its own commands. Loops of the
+ *              caller are out of reach of break and continue, and
+ *              variables made local are restored on the way out.
+ */
+int func_call(node_t *body, char **args, int *exe_ret)
+{
+	char **saved_args = pos_args;
+	int saved_count = pos_count, saved_depth = loop_depth, ret;
+	local_t *mark = locals;
+
+	pos_args = args + 1;
+	for (pos_count = 0; pos_args[pos_count]; pos_count++)
+		;
+	loop_depth = 0;
+	func_depth++;
+	body->refs++;
+	ret = exec_node(body, exe_ret, 0);
+	func_unref(body);
+	func_depth--;
+	func_return = 0;
+	loop_depth = saved_depth;
+	local_restore(mark);
+	pos_args = saved_args;
+	pos_count = saved_count;
+	free_args(args, args);
+	return (ret);
+}
+
+/**
+ * shellby_return - Returns from a function.
+ * @args: An array of arguments. args[0], if given, is the return value.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If the value is invalid - 2.
+ *         If none is given - RETURN_LAST, to keep the last return value.
+ *         Otherwise - the value, modulo 256.
+ *
+ * Description: Outside of a function the rest of the script is skipped.
+ */
+int shellby_return(char **args, char __attribute__((__unused__)) **front)
+{
+	int i, n = 0;
+
+	func_return = 1;
+	loop_break = loop_depth;
+	loop_cont = 0;
+	if (!args[0])
+		return (RETURN_LAST);
+	for (i = 0; args[0][i] >= '0' && args[0][i] <= '9'; i++)
+		n = (n * 10 + (args[0][i] - '0')) % 256;
+	if (!i || args[0][i])
+	{
+		print_error(ERR_RETURN_NUM, args[0]);
+		return (2);
+	}
+	return (n);
+}
+
+/**
+ * shellby_local - Makes variables local to the running function.
+ * @args: An array of arguments, each NAME or NAME=VALUE.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If used outside of a function or a name is invalid - 2.
+ *         If memory runs out - 1.
+ *         Otherwise - 0.
+ *
+ * Description: A variable given without a value keeps its value. Either
+ *              way the value it had is restored when the function returns.
+ */
+int shellby_local(char **args, char __attribute__((__unused__)) **front)
+{
+	char *word;
+	int i, len;
+
+	if (!func_depth)
+	{
+		print_error(ERR_LOCAL, "");
+		return (2);
+	}
+	for (i = 0; args[i]; i++)
+	{
+		len = name_len(args[i]);
+		if (!len || (args[i][len] && args[i][len] != '='))
+		{
+			print_error(ERR_LOCAL_NAME, args[i]);
+			return (2);
+		}
+		if (local_save(args[i], len) == -1)
+			return (1);
+		if (!args[i][len])
+			continue;
+		word = malloc(_strlen(args[i]) + 1);
+		if (!word || var_assign(_strcpy(word, args[i])) == -1)
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * local_save - Records the value of a variable, to restore it when the
+ *              running function returns.
+ * @var: The variable name, possibly followed by "=VALUE".
+ * @len: The length of the name.
+ *
+ * Return: 0 on success, or -1 if memory ran out.
+ */
+int local_save(char *var, int len)
+{
+	local_t *l = malloc(sizeof(local_t));
+	char **env;
+
+	if (!l)
+		return (-1);
+	l->name = malloc(len + 1);
+	if (!l->name)
+	{
+		free(l);
+		return (-1);
+	}
+	l->name[0] = '\0';
+	_strncat(l->name, var, len);
+	env = _getenv(l->name);
+	l->saved = env ? malloc(_strlen(*env) + 1) : NULL;
+	if (env && !l->saved)
+	{
+		free(l->name);
+		free(l);
+		return (-1);
+	}
+	if (env)
+		_strcpy(l->saved, *env);
+	l->next = locals;
+	locals = l;
+	return (0);
+}
+
+/**
+ * local_restore - Restores the variables made local since a point.
+ * @mark: The most recent local variable to keep.
+ *
+ * Description: Variables are restored newest first, so a variable made
+ *              local twice ends up with the value it had before either.
+ */
+void local_restore(local_t *mark)
+{
+	local_t *l;
+	char **env;
+
+	while (locals != mark)
+	{
+		l = locals;
+		locals = l->next;
+		env = _getenv(l->name);
+		if (l->saved && env_set(env, l->saved) == -1)
+			free(l->saved);
+		else if (!l->saved && env)
+			env_remove(env);
+		free(l->name);
+		free(l);
+	}
+}
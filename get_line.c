@@ -3,6 +3,7 @@
 void *_realloc(void *ptr, unsigned int old_size, unsigned int new_size);
 void assign_lineptr(char **lineptr, size_t *n, char *buffer, size_t b);
 ssize_t _getline(char **lineptr, size_t *n, FILE *stream);
+int input_at_eof(void);
 
 /**
  * _realloc - Reallocates a memory block using malloc and free.
@@ -94,6 +95,10 @@ void assign_lineptr(char **lineptr, size_t *n, char *buffer, size_t b)
  * @stream: The stream to read from.
  *
  * Return: The number of bytes read.
+ *
+ * Description: A regular file on standard input is read in blocks by
+ *              in_getline; anything else is read a byte at a time so that
+ *              no input meant for the commands is consumed.
  */
 ssize_t _getline(char **lineptr, size_t *n, FILE *stream)
 {
@@ -102,6 +107,8 @@ ssize_t _getline(char **lineptr, size_t *n, FILE *stream)
 	char c = 'x', *buffer;
 	int r;
 
+	if (in_block())
+		return (in_getline(lineptr, n));
 	if (input == 0)
 		fflush(stream);
 	else
@@ -141,3 +148,32 @@ ssize_t _getline(char **lineptr, size_t *n, FILE *stream)
 		input = 0;
 	return (ret);
 }
+
+/**
+ * input_at_eof - Checks, without blocking, whether standard input has
+ *                nothing left to read.
+ *
+ * Return: If standard input is known to be exhausted - 1.
+ *         Otherwise - 0.
+ *
+ * Description: A regular file is exhausted when its offset has reached its
+ *              size. A pipe is exhausted when every writer has closed it
+ *              and no data is queued.
+ */
+int input_at_eof(void)
+{
+	struct stat st;
+	struct pollfd pfd;
+	int queued = 0;
+
+	if (fstat(STDIN_FILENO, &st) == 0 && S_ISREG(st.st_mode))
+		return (lseek(STDIN_FILENO, 0, SEEK_CUR) >= st.st_size);
+
+	pfd.fd = STDIN_FILENO;
+	pfd.events = POLLIN;
+	if (poll(&pfd, 1, 0) != 1 || !(pfd.revents & POLLHUP))
+		return (0);
+	if (ioctl(STDIN_FILENO, FIONREAD, &queued) == -1)
+		return (0);
+	return (queued == 0);
+}
@@ -0,0 +1,162 @@
+#include "shell.h"
+
+char **glob_words(char **args);
+void glob_walk(glob_ctx_t *g, int plen, char *rest);
+void glob_match_dir(glob_ctx_t *g, int plen, char *comp, char *rest);
+void glob_push(glob_ctx_t *g, char *s);
+int glob_magic(char *s);
+
+/**
+ * glob_words - Expands the pathname patterns among the words of a command.
+ * @args: The expanded words, terminated by two NULL entries. They are
+ *        freed unless none of them is a pattern.
+ *
+ * Return: The words with each pattern replaced by the sorted pathnames
+ *         it matches, or kept as is if it matches none. NULL if memory
+ *         ran out.
+ *
+ * Description: Directories are read once per command, however many
+ *              patterns look into them.
+ */
+char **glob_words(char **args)
+{
+	glob_ctx_t g;
+	size_t start;
+	int i;
+
+	for (i = 0; args[i] && !glob_magic(args[i]); i++)
+		;
+	if (!args[i])
+		return (args);
+	_memset(&g, 0, sizeof(g));
+	for (i = 0; args[i] && !g.err; i++)
+	{
+		start = g.out.n;
+		if (glob_magic(args[i]))
+			glob_walk(&g, 0, args[i]);
+		if (g.out.n == start)
+			glob_push(&g, args[i]);
+		else
+			glob_sort(g.out.v + start, g.out.n - start);
+	}
+	glob_free(g.dirs);
+	free_args(args, args);
+	if (g.err && g.out.v)
+	{
+		free_args(g.out.v, g.out.v);
+		return (NULL);
+	}
+	return (g.out.v);
+}
+
+/**
+ * glob_walk - Expands the rest of a pattern below a path.
+ * @g: The expansion state. g->path holds the path so far.
+ * @plen: The length of the path so far.
+ * @rest: The rest of the pattern. Its slashes are restored on return.
+ */
+void glob_walk(glob_ctx_t *g, int plen, char *rest)
+{
+	char *slash;
+	struct stat st;
+	int len;
+
+	while (*rest == '/' && plen < GLOB_PATH_MAX - 1)
+		g->path[plen++] = *rest++;
+	g->path[plen] = '\0';
+	slash = _strchr(rest, '/');
+	if (slash)
+		*slash = '\0';
+	len = _strlen(rest);
+	if (glob_magic(rest))
+		glob_match_dir(g, plen, rest, slash ? slash + 1 : NULL);
+	else if (plen + len + 1 < GLOB_PATH_MAX)
+	{
+		_memcpy(g->path + plen, rest, len + 1);
+		if (slash)
+		{
+			*slash = '/';
+			glob_walk(g, plen + len, slash);
+		}
+		else if (lstat(g->path, &st) == 0)
+			glob_push(g, g->path);
+	}
+	if (slash)
+		*slash = '/';
+}
+
+/**
+ * glob_match_dir - Matches the entries of a directory against one
+ *                  component of a pattern.
+ * @g: The expansion state. g->path holds the directory.
+ * @plen: The length of the directory's path.
+ * @comp: The component.
+ * @rest: The components after it, or NULL if it is the last one.
+ *
+ * Description: Names starting with a '.' only match a component that
+ *              starts with one. Only directories are descended into.
+ */
+void glob_match_dir(glob_ctx_t *g, int plen, char *comp, char *rest)
+{
+	glob_dir_t *dir = glob_dir(g, plen);
+	char *e, *end;
+	int len, link, room = GLOB_PATH_MAX - plen - 2;
+
+	if (!dir)
+		return;
+	end = dir->names + dir->used;
+	for (e = dir->names; e < end && !g->err; e += len + 2)
+	{
+		len = _strlen(e + 1);
+		if (e[1] == '.' && *comp != '.')
+			continue;
+		if (len > room || !pattern_match(comp, e + 1))
+			continue;
+		_memcpy(g->path + plen, e + 1, len + 1);
+		link = *e == DT_LNK || *e == DT_UNKNOWN;
+		if (!rest)
+			glob_push(g, g->path);
+		else if (*e == DT_DIR || (link && glob_is_dir(g->path)))
+		{
+			g->path[plen + len] = '/';
+			g->path[plen + len + 1] = '\0';
+			glob_walk(g, plen + len + 1, rest);
+		}
+	}
+}
+
+/**
+ * glob_push - Adds a copy of a word to the expanded words.
+ * @g: The expansion state. g->err is set if memory runs out.
+ * @s: The word.
+ */
+void glob_push(glob_ctx_t *g, char *s)
+{
+	char *copy = malloc(_strlen(s) + 1);
+
+	if (argv_push(&g->out, copy ? _strcpy(copy, s) : NULL) == -1)
+		g->err = 1;
+}
+
+/**
+ * glob_magic - Checks if a word is a pathname pattern.
+ * @s: The word.
+ *
+ * Return: 1 if it holds a '*', a '?' or a '[' closed by a ']', or 0.
+ *         A lone "[", as in the test command, is not a pattern.
+ */
+int glob_magic(char *s)
+{
+	char *open = NULL;
+
+	for (; *s; s++)
+	{
+		if (*s == '\\' && s[1])
+			s++;
+		else if (*s == '*' || *s == '?' || (open && *s == ']'))
+			return (1);
+		else if (*s == '[' && !open)
+			open = s + 1;
+	}
+	return (0);
+}
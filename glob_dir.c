@@ -0,0 +1,123 @@
+#include "shell.h"
+
+glob_dir_t *glob_dir(glob_ctx_t *g, int plen);
+int glob_read(glob_dir_t *dir, int fd);
+int glob_is_dir(char *path);
+void glob_free(glob_dir_t *dir);
+
+/**
+ * glob_dir - Gets the listing of a directory, reading it on first use.
+ * @g: The expansion state. g->path holds the directory.
+ * @plen: The length of the directory's path, 0 for the current directory.
+ *
+ * Return: The listing, or NULL if the directory cannot be read. g->err
+ *         is set if memory ran out.
+ */
+glob_dir_t *glob_dir(glob_ctx_t *g, int plen)
+{
+	glob_dir_t *dir;
+	int fd, ret;
+
+	g->path[plen] = '\0';
+	for (dir = g->dirs; dir; dir = dir->next)
+	{
+		if (_strcmp(dir->path, g->path) == 0)
+			return (dir);
+	}
+	fd = open(plen ? g->path : ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd == -1)
+		return (NULL);
+	dir = malloc(sizeof(glob_dir_t));
+	if (dir)
+	{
+		_memset(dir, 0, sizeof(glob_dir_t));
+		dir->path = malloc(plen + 1);
+	}
+	ret = dir && dir->path ? glob_read(dir, fd) : -2;
+	close(fd);
+	if (ret != 0)
+	{
+		g->err = ret == -2;
+		glob_free(dir);
+		return (NULL);
+	}
+	_strcpy(dir->path, g->path);
+	dir->next = g->dirs;
+	g->dirs = dir;
+	return (dir);
+}
+
+/**
+ * glob_read - Reads the entries of a directory into its listing.
+ * @dir: The listing.
+ * @fd: The open directory.
+ *
+ * Return: 0 on success, -1 if the directory could not be read, or -2 if
+ *         memory ran out.
+ *
+ * Description: The kernel's records are read in large batches with
+ *              getdents64 and their names packed into a single buffer
+ *              that doubles as it fills, so a directory costs a handful
+ *              of allocations whatever the number of its entries.
+ */
+int glob_read(glob_dir_t *dir, int fd)
+{
+	char buf[GLOB_DENTS], *new;
+	struct dirent64 *d;
+	long n, off;
+	size_t len, cap;
+
+	while ((n = syscall(SYS_getdents64, fd, buf, GLOB_DENTS)) > 0)
+	{
+		for (off = 0; off < n; off += d->d_reclen)
+		{
+			d = (struct dirent64 *)(buf + off);
+			len = _strlen(d->d_name) + 2;
+			cap = dir->cap ? dir->cap : 4096;
+			while (cap < dir->used + len)
+				cap *= 2;
+			if (cap != dir->cap)
+			{
+				new = _realloc(dir->names, dir->cap, cap);
+				if (!new)
+					return (-2);
+				dir->names = new;
+				dir->cap = cap;
+			}
+			dir->names[dir->used] = d->d_type;
+			_memcpy(dir->names + dir->used + 1, d->d_name, len - 1);
+			dir->used += len;
+		}
+	}
+	return (n == -1 ? -1 : 0);
+}
+
+/**
+ * glob_is_dir - Checks if a path leads to a directory, following links.
+ * @path: The path.
+ *
+ * Return: 1 if it does, or 0 if it does not.
+ */
+int glob_is_dir(char *path)
+{
+	struct stat st;
+
+	return (stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+}
+
+/**
+ * glob_free - Frees the directory listings read for a command.
+ * @dir: The most recent listing.
+ */
+void glob_free(glob_dir_t *dir)
+{
+	glob_dir_t *next;
+
+	for (; dir; dir = next)
+	{
+		next = dir->next;
+		free(dir->path);
+		free(dir->names);
+		free(dir);
+	}
+}
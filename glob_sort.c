@@ -0,0 +1,99 @@
+#include "shell.h"
+
+void glob_sort(char **v, size_t n);
+void glob_merge(glob_key_t *src, glob_key_t *dst, size_t lo, size_t mid,
+		size_t hi);
+unsigned long glob_key(char *s);
+
+/**
+ * glob_sort - Sorts pathnames in byte order.
+ * @v: The pathnames.
+ * @n: The number of pathnames.
+ *
+ * Description: A bottom-up merge sort over (key, string) pairs. Each pass
+ *              streams through two arrays and compares the keys held in
+ *              them; the strings themselves are only read past their
+ *              first 8 bytes, for names sharing a long prefix. They are
+ *              left unsorted if memory runs out.
+ */
+void glob_sort(char **v, size_t n)
+{
+	glob_key_t *base, *a, *b, *t;
+	size_t i, w;
+
+	if (n < 2)
+		return;
+	base = malloc(sizeof(glob_key_t) * n * 2);
+	if (!base)
+		return;
+	a = base;
+	b = base + n;
+	for (i = 0; i < n; i++)
+	{
+		a[i].key = glob_key(v[i]);
+		a[i].s = v[i];
+	}
+	for (w = 1; w < n; w *= 2)
+	{
+		for (i = 0; i < n; i += 2 * w)
+			glob_merge(a, b, i, i + w < n ? i + w : n,
+				   i + 2 * w < n ? i + 2 * w : n);
+		t = a;
+		a = b;
+		b = t;
+	}
+	for (i = 0; i < n; i++)
+		v[i] = a[i].s;
+	free(base);
+}
+
+/**
+ * glob_merge - Merges two sorted runs.
+ * @src: The array holding the runs.
+ * @dst: The array to merge them into.
+ * @lo: The start of the first run.
+ * @mid: The end of the first run and start of the second.
+ * @hi: The end of the second run.
+ */
+void glob_merge(glob_key_t *src, glob_key_t *dst, size_t lo, size_t mid,
+		size_t hi)
+{
+	size_t i = lo, j = mid, k = lo;
+	int cmp;
+
+	while (i < mid && j < hi)
+	{
+		if (src[i].key != src[j].key)
+			cmp = src[i].key < src[j].key ? -1 : 1;
+		else if (!(src[i].key & 0xff))
+			cmp = 0;
+		else
+			cmp = _strcmp(src[i].s + 8, src[j].s + 8);
+		dst[k++] = src[cmp <= 0 ? i++ : j++];
+	}
+	while (i < mid)
+		dst[k++] = src[i++];
+	while (j < hi)
+		dst[k++] = src[j++];
+}
+
+/**
+ * glob_key - Packs the first 8 bytes of a string into a number.
+ * @s: The string.
+ *
+ * Return: The bytes, the first one most significant and zero past the
+ *         end of the string, so that numbers sort like the strings.
+ */
+unsigned long glob_key(char *s)
+{
+	unsigned long key = 0;
+	int i;
+
+	for (i = 0; i < 8; i++)
+	{
+		key <<= 8;
+		if (*s)
+			key |= (unsigned char)*s++;
+	}
+	return (key);
+}
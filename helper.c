@@ -3,7 +3,8 @@
 void free_args(char **args, char **front);
 char *get_pid(void);
 char *get_env_value(char *beginning, int len);
-void variable_replacement(char **args, int *exe_ret);
+char *get_replacement(char *line, int j, int *k, int *exe_ret);
+int variable_replacement(char **args, int *exe_ret);
 
 /**
  * free_args - Frees up memory taken by args.
@@ -93,16 +94,66 @@ char *get_env_value(char *beginning, int len)
 	return (replacement);
 }
 
+/**
+ * get_replacement - Gets the value of the expansion at a '$'.
+ * @line: The line.
+ * @j: The index of the '$' in line.
+ * @k: Where to store the index just past the expansion, j if the '$' is
+ *     not followed by a name and is kept as is, or -1 if an arithmetic
+ *     expansion or a command substitution failed.
+ * @exe_ret: A pointer to the return value of the last executed command.
+ *
+ * Return: The malloc'd value, or NULL if it is empty.
+ */
+char *get_replacement(char *line, int j, int *k, int *exe_ret)
+{
+	char *replacement;
+	int len;
+
+	if (_strchr("$?#@*0123456789", line[j + 1]))
+	{
+		*k = j + 2;
+		return (param_value(line[j + 1], exe_ret));
+	}
+	if (line[j + 1] == '(' && line[j + 2] == '(')
+	{
+		replacement = arith_expand(line + j, &len, exe_ret);
+		*k = replacement ? j + len : -1;
+		return (replacement);
+	}
+	if (line[j + 1] == '(')
+	{
+		replacement = cmdsub_expand(line + j, &len, exe_ret);
+		*k = len == -1 ? -1 : j + len;
+		return (replacement);
+	}
+	/* extract the variable name to search for */
+	*k = j + 1 + name_len(line + j + 1);
+	if (*k == j + 1)
+	{
+		*k = j;
+		return (NULL);
+	}
+	return (get_env_value(&line[j + 1], *k - (j + 1)));
+}
+
 /**
  * variable_replacement - Handles variable replacement.
  * @line: A double pointer containing the command and arguments.
  * @exe_ret: A pointer to the return value of the last executed command.
  *
  * Description: Replaces $$ with the current PID, $? with the return value
- *              of the last executed program, and envrionmental variables
- *              preceded by $ with their corresponding value.
+ *              of the last executed program, $#, $@, $* and $0 to $9 with
+ *              the positional parameters, $(...) with the output of the
+ *              commands, $(( )) with the value of the
+ *              arithmetic expression and envrionmental variables preceded
+ *              by $ with their corresponding value.
+ *
+ * Return: 0 on success.
+ *         -1 if memory ran out, or if an arithmetic expansion failed, in
+ *         which case the line is emptied and $? becomes 2.
  */
-void variable_replacement(char **line, int *exe_ret)
+int variable_replacement(char **line, int *exe_ret)
 {
 	int j, k = 0, len;
 	char *replacement = NULL, *old_line = NULL, *new_line;
@@ -113,30 +164,19 @@ void variable_replacement(char **line, int *exe_ret)
 		if (old_line[j] == '$' && old_line[j + 1] &&
 				old_line[j + 1] != ' ')
 		{
-			if (old_line[j + 1] == '$')
-			{
-				replacement = get_pid();
-				k = j + 2;
-			}
-			else if (old_line[j + 1] == '?')
-			{
-				replacement = _itoa(*exe_ret);
-				k = j + 2;
-			}
-			else if (old_line[j + 1])
+			replacement = get_replacement(old_line, j, &k, exe_ret);
+			if (k == -1)
 			{
-				/* extract the variable name to search for */
-				for (k = j + 1; old_line[k] &&
-						old_line[k] != '$' &&
-						old_line[k] != ' '; k++)
-					;
-				len = k - (j + 1);
-				replacement = get_env_value(&old_line[j + 1], len);
+				old_line[0] = '\0';
+				*exe_ret = 2;
+				return (-1);
 			}
-			new_line = malloc(j + _strlen(replacement)
-					  + _strlen(&old_line[k]) + 1);
-			if (!line)
-				return;
+			if (k == j)
+				continue;
+			len = _strlen(replacement);
+			new_line = malloc(j + len + _strlen(&old_line[k]) + 1);
+			if (!new_line)
+				return (-1);
 			new_line[0] = '\0';
 			_strncat(new_line, old_line, j);
 			if (replacement)
@@ -149,7 +189,8 @@ void variable_replacement(char **line, int *exe_ret)
 			free(old_line);
 			*line = new_line;
 			old_line = new_line;
-			j = -1;
+			j += len - 1;
 		}
 	}
+	return (0);
 }
@@ -0,0 +1,201 @@
+#include "shell.h"
+
+void parse_heredoc(parse_t *ps, node_t *n);
+void heredoc_read(parse_t *ps);
+void heredoc_body(parse_t *ps, node_t *n);
+int heredoc_exec(node_t *n, int *exe_ret, int tail);
+int heredoc_fd(char *text, size_t len, int nl);
+
+/**
+ * parse_heredoc - Parses a "<<", "<<-" or "<<<" redirection of a command.
+ * @ps: The parser state, at the redirection. The delimiter or here-string
+ *      may be part of the same word or be the next word.
+ * @n: The command.
+ *
+ * Description: A here-string is kept as written. A here-document's
+ *              delimiter is kept until the body is read after the next
+ *              newline. Quotes in the delimiter are dropped, and make
+ *              the body literal.
+ */
+void parse_heredoc(parse_t *ps, node_t *n)
+{
+	char *op = ps->start, *d;
+	int skip, i, j;
+
+	if (n->name || ps->npending == HEREDOC_MAX)
+	{
+		parse_error(ps);
+		return;
+	}
+	n->heredoc = op[2] == '<' ? HD_STRING : (op[2] == '-' ? HD_STRIP : 0);
+	skip = 2 + (op[2] == '<' || op[2] == '-');
+	if (ps->len == skip)
+	{
+		lex_next(ps, 0);
+		if (ps->tok != T_WORD)
+		{
+			parse_error(ps);
+			return;
+		}
+		skip = 0;
+	}
+	n->name = d = malloc(ps->len - skip + 1);
+	if (!d)
+	{
+		ps->status = PARSE_ERR;
+		return;
+	}
+	d[0] = '\0';
+	_strncat(d, ps->start + skip, ps->len - skip);
+	if (n->heredoc & HD_STRING)
+		return;
+	for (i = j = 0; d[i]; i++)
+	{
+		if (d[i] == '\'' || d[i] == '"' || d[i] == '\\')
+			n->heredoc |= HD_LITERAL;
+		else
+			d[j++] = d[i];
+	}
+	d[j] = '\0';
+	ps->pending[ps->npending++] = n;
+}
+
+/**
+ * heredoc_read - Reads the bodies of the here-documents started on the
+ *                line that just ended.
+ * @ps: The parser state, just past the newline.
+ */
+void heredoc_read(parse_t *ps)
+{
+	int i;
+
+	for (i = 0; i < ps->npending && !ps->status; i++)
+		heredoc_body(ps, ps->pending[i]);
+	ps->npending = 0;
+}
+
+/**
+ * heredoc_body - Reads the body of a here-document.
+ * @ps: The parser state, at the first line of the body. It is moved past
+ *      the delimiter line.
+ * @n: The command. Its delimiter is replaced by the body.
+ *
+ * Description: Without the delimiter line, the input is incomplete. For
+ *              "<<-", leading tabs are removed from every line.
+ */
+void heredoc_body(parse_t *ps, node_t *n)
+{
+	char *line = ps->p, *end, *body, *s;
+	int dlen = _strlen(n->name), strip = n->heredoc & HD_STRIP;
+	int i = 0, bol = 1;
+
+	while (1)
+	{
+		for (s = line; strip && *s == '\t'; s++)
+			;
+		for (end = s; *end && *end != '\n'; end++)
+			;
+		if (end - s == dlen && _strncmp(s, n->name, dlen) == 0)
+			break;
+		if (!*end)
+		{
+			ps->status = PARSE_MORE;
+			return;
+		}
+		line = end + 1;
+	}
+	body = malloc(line - ps->p + 1);
+	if (!body)
+	{
+		ps->status = PARSE_ERR;
+		return;
+	}
+	for (s = ps->p; s < line; s++)
+	{
+		if (!(strip && bol && *s == '\t'))
+			body[i++] = *s;
+		bol = *s == '\n' || (bol && *s == '\t');
+	}
+	body[i] = '\0';
+	free(n->name);
+	n->name = body;
+	ps->p = *end ? end + 1 : end;
+}
+
+/**
+ * heredoc_exec - Runs a command with its here-document as input.
+ * @n: The command.
+ * @exe_ret: The return value of the last executed command.
+ * @tail: Non-zero if nothing runs after this command.
+ *
+ * Return: The return value of the command.
+ *
+ * Description: The body is expanded, unless its delimiter was quoted, each
+ *              time the command runs. The programs the command starts get
+ *              it as standard input; the shell's own input is untouched.
+ */
+int heredoc_exec(node_t *n, int *exe_ret, int tail)
+{
+	char *s = NULL;
+	int fd, saved = cmd_stdin, ret;
+
+	if (!(n->heredoc & HD_LITERAL))
+	{
+		s = expand_word(n->name, exe_ret);
+		if (!s)
+			return (*exe_ret = 2);
+	}
+	fd = heredoc_fd(s ? s : n->name, _strlen(s ? s : n->name),
+			n->heredoc & HD_STRING);
+	free(s);
+	if (fd == -1)
+	{
+		perror("Error here-document:");
+		return (*exe_ret = 1);
+	}
+	cmd_stdin = fd;
+	ret = n->words ? exec_simple(n->words, exe_ret, tail) : (*exe_ret = 0);
+	cmd_stdin = saved;
+	close(fd);
+	return (ret);
+}
+
+/**
+ * heredoc_fd - Puts the text of a here-document in a readable descriptor.
+ * @text: The text.
+ * @len: The length of text.
+ * @nl: Non-zero to add a newline, for a here-string.
+ *
+ * Return: The descriptor, positioned at the start of the text, or -1.
+ *
+ * Description: Text that fits a pipe buffer goes through a pipe, which
+ *              never blocks at that size. Larger text is written to a
+ *              sealed memfd, which lives in memory and disappears with
+ *              its last descriptor, so nothing is left on disk.
+ */
+int heredoc_fd(char *text, size_t len, int nl)
+{
+	struct iovec iov[2];
+	int fd[2];
+
+	iov[0].iov_base = text;
+	iov[0].iov_len = len;
+	iov[1].iov_base = "\n";
+	iov[1].iov_len = nl != 0;
+	if (len + 1 <= HEREDOC_PIPE)
+	{
+		if (pipe2(fd, O_CLOEXEC) == -1)
+			return (-1);
+		writev_all(fd[1], iov, 2);
+		close(fd[1]);
+		return (fd[0]);
+	}
+	fd[0] = memfd_create("heredoc", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (fd[0] == -1)
+		return (-1);
+	writev_all(fd[0], iov, 2);
+	fcntl(fd[0], F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE |
+	      F_SEAL_SEAL);
+	lseek(fd[0], 0, SEEK_SET);
+	return (fd[0]);
+}
@@ -0,0 +1,157 @@
+#include "shell.h"
+
+int hist_open(void);
+void hist_close(void);
+void hist_add(char *line);
+int hist_get(unsigned long seq, char *buf, unsigned long sig);
+unsigned long hist_count(unsigned long *first);
+
+static size_t hist_map_size;
+
+/**
+ * hist_open - Maps the shared history ring file ~/.hsh_history.
+ *
+ * Return: If the file cannot be opened or is not a history ring - -1.
+ *         Otherwise - 0.
+ *
+ * Description: The file is a fixed-size ring of HIST_LINE byte slots
+ *              shared by every running shell through MAP_SHARED. A file
+ *              written before the search index existed is indexed from
+ *              its next entry on.
+ */
+int hist_open(void)
+{
+	char **home = _getenv("HOME"), *path;
+	hist_head_t head;
+	size_t size;
+	int fd;
+
+	if (hist_map || !home)
+		return (hist_map ? 0 : -1);
+	path = malloc(_strlen(*home + 5) + 15);
+	if (!path)
+		return (-1);
+	_strcpy(path, *home + 5);
+	_strcat(path, "/.hsh_history");
+	fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+	free(path);
+	if (fd == -1)
+		return (-1);
+	head.slots = HIST_SLOTS;
+	if (pread(fd, &head, sizeof(head), 0) == sizeof(head) &&
+			head.magic != HIST_MAGIC)
+		head.slots = head.magic ? 0 : HIST_SLOTS;
+	size = hist_file_size(head.slots);
+	if (!head.slots || ftruncate(fd, size) == -1)
+	{
+		close(fd);
+		return (-1);
+	}
+	hist_map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (hist_map == MAP_FAILED)
+	{
+		hist_map = NULL;
+		return (-1);
+	}
+	hist_map_size = size;
+	__sync_bool_compare_and_swap(&hist_map->slots, 0, head.slots);
+	__sync_bool_compare_and_swap(&hist_map->indexed, 0,
+			hist_map->next + 1);
+	__sync_bool_compare_and_swap(&hist_map->magic, 0, HIST_MAGIC);
+	return (0);
+}
+
+/**
+ * hist_close - Unmaps the history ring file.
+ */
+void hist_close(void)
+{
+	if (hist_map)
+		munmap(hist_map, hist_map_size);
+	hist_map = NULL;
+}
+
+/**
+ * hist_add - Appends a command line to the history ring.
+ * @line: The command line.
+ *
+ * Description: A slot is claimed with an atomic increment of the shared
+ *              write counter, so concurrent shells never share a slot.
+ *              The slot's sequence number is cleared while it is written
+ *              and published last, which lets readers detect torn reads.
+ */
+void hist_add(char *line)
+{
+	hist_slot_t *slot;
+	unsigned long seq, *sigs = (unsigned long *)(hist_map + 1);
+	int len = _strlen(line);
+
+	if (!hist_map || len == 0)
+		return;
+	if (len >= HIST_LINE)
+		len = HIST_LINE - 1;
+	seq = __sync_fetch_and_add(&hist_map->next, 1);
+	slot = (hist_slot_t *)(sigs + hist_map->slots) + seq % hist_map->slots;
+	slot->seq = 0;
+	__sync_synchronize();
+	_memcpy(slot->line, line, len);
+	slot->line[len] = '\0';
+	sigs[seq % hist_map->slots] = hist_sig(slot->line, len);
+	hist_index_add(seq, slot->line, len);
+	__sync_synchronize();
+	slot->seq = seq + 1;
+}
+
+/**
+ * hist_get - Copies a history entry out of the ring.
+ * @seq: The sequence number of the entry.
+ * @buf: A buffer of at least HIST_LINE bytes.
+ * @sig: A bigram signature the entry must cover, or 0 to accept any.
+ *
+ * Return: If the entry was overwritten, is being written or does not
+ *         cover sig - -1.
+ *         Otherwise - the length of the entry.
+ */
+int hist_get(unsigned long seq, char *buf, unsigned long sig)
+{
+	hist_slot_t *slot;
+	unsigned long *sigs;
+	int len;
+
+	if (!hist_map)
+		return (-1);
+	sigs = (unsigned long *)(hist_map + 1);
+	if ((sigs[seq % hist_map->slots] & sig) != sig)
+		return (-1);
+	slot = (hist_slot_t *)(sigs + hist_map->slots) + seq % hist_map->slots;
+	if (slot->seq != seq + 1)
+		return (-1);
+	__sync_synchronize();
+	for (len = 0; len < HIST_LINE - 1 && slot->line[len]; len++)
+		buf[len] = slot->line[len];
+	buf[len] = '\0';
+	__sync_synchronize();
+	if (slot->seq != seq + 1)
+		return (-1);
+	return (len);
+}
+
+/**
+ * hist_count - Gets the range of sequence numbers held by the ring.
+ * @first: Set to the oldest sequence number not yet overwritten.
+ *
+ * Return: One past the newest sequence number.
+ */
+unsigned long hist_count(unsigned long *first)
+{
+	unsigned long next;
+
+	*first = 0;
+	if (!hist_map)
+		return (0);
+	next = hist_map->next;
+	if (next > hist_map->slots)
+		*first = next - hist_map->slots;
+	return (next);
+}
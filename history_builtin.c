@@ -0,0 +1,162 @@
+#include "shell.h"
+
+unsigned long hist_sig(char *str, int len);
+void print_hist_entry(unsigned long seq, char *line, int len);
+int hist_search(char **args);
+int hist_query(char *query, int *buckets);
+int shellby_history(char **args, char __attribute__((__unused__)) **front);
+
+/**
+ * hist_sig - Computes the bigram signature of a string.
+ * @str: The string.
+ * @len: The length of str.
+ *
+ * Return: A 64-bit mask with one bit set per character pair in str.
+ *
+ * Description: Every bigram of a substring is also a bigram of the
+ *              string containing it, so an entry can only match a query
+ *              when its signature covers the query's signature.
+ */
+unsigned long hist_sig(char *str, int len)
+{
+	unsigned long sig = 0;
+	int i;
+
+	for (i = 0; i + 1 < len; i++)
+		sig |= 1UL << (((unsigned char)str[i] * 31 +
+					(unsigned char)str[i + 1]) & 63);
+	return (sig);
+}
+
+/**
+ * print_hist_entry - Prints a history entry as its number and text.
+ * @seq: The sequence number of the entry.
+ * @line: The text of the entry.
+ * @len: The length of line.
+ */
+void print_hist_entry(unsigned long seq, char *line, int len)
+{
+	struct iovec iov[4];
+	char num[24];
+	int num_len = _itoa_buf(seq + 1, num);
+
+	iov[0].iov_base = "     ";
+	iov[0].iov_len = num_len < 5 ? 5 - num_len : 0;
+	iov[1].iov_base = num;
+	iov[1].iov_len = num_len;
+	iov[2].iov_base = "  ";
+	iov[2].iov_len = 2;
+	iov[3].iov_base = line;
+	iov[3].iov_len = len;
+	out_writev(iov, 4);
+	out_write("\n", 1);
+}
+
+/**
+ * hist_search - Prints every history entry containing a string.
+ * @args: The words of the string to search for.
+ *
+ * Return: If nothing matched - 1.
+ *         Otherwise - 0.
+ *
+ * Description: Entries written before the file had a search index are
+ *              screened one by one by signature, straight in the shared
+ *              mapping. The rest are found through the index.
+ */
+int hist_search(char **args)
+{
+	char query[HIST_LINE], line[HIST_LINE];
+	unsigned long seq, first, next, sig, from;
+	int i, len, n, buckets[HIST_LINE], ret = 1;
+
+	query[0] = '\0';
+	for (i = 0; args[i]; i++)
+	{
+		if (_strlen(query) + _strlen(args[i]) + 2 > HIST_LINE)
+			break;
+		if (i)
+			_strcat(query, " ");
+		_strcat(query, args[i]);
+	}
+	sig = hist_sig(query, _strlen(query));
+	next = hist_count(&first);
+	from = first;
+	if (next && hist_map->indexed > first)
+		from = hist_map->indexed - 1;
+	for (seq = first; seq < from; seq++)
+	{
+		len = hist_get(seq, line, sig);
+		if (len != -1 && _strstr(line, query))
+		{
+			print_hist_entry(seq, line, len);
+			ret = 0;
+		}
+	}
+	n = hist_query(query, buckets);
+	if (next && !hist_index_scan(query, buckets, n, from, next))
+		ret = 0;
+	return (ret);
+}
+
+/**
+ * hist_query - Gets the index bitmaps of a search string.
+ * @query: The search string.
+ * @buckets: Set to the distinct index bitmaps of the string's bigrams.
+ *
+ * Return: The number of bitmaps.
+ */
+int hist_query(char *query, int *buckets)
+{
+	int i, j, b, n = 0;
+
+	for (i = 0; query[i] && query[i + 1]; i++)
+	{
+		b = hist_bucket(query + i);
+		for (j = 0; j < n && buckets[j] != b; j++)
+			;
+		if (j == n)
+			buckets[n++] = b;
+	}
+	return (n);
+}
+
+/**
+ * shellby_history - Prints the command history.
+ * @args: An array of arguments.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If an error occurs - 2.
+ *         Otherwise - 0, or 1 when a search matches nothing.
+ *
+ * Description: 'history' prints every entry, 'history N' the last N and
+ *              'history -s STRING' the entries containing STRING.
+ */
+int shellby_history(char **args, char __attribute__((__unused__)) **front)
+{
+	char line[HIST_LINE];
+	unsigned long seq, first, next, count = 0;
+	int len, i;
+
+	if (args[0] && _strcmp(args[0], "-s") == 0)
+		return (args[1] ? hist_search(args + 1) : 0);
+	next = hist_count(&first);
+	if (args[0])
+	{
+		for (i = 0; args[0][i] >= '0' && args[0][i] <= '9'; i++)
+			count = count * 10 + (args[0][i] - '0');
+		if (i == 0 || args[0][i] != '\0')
+		{
+			print_error(ERR_HIST_NUM, args[0]);
+			return (2);
+		}
+		if (count < next - first)
+			first = next - count;
+	}
+	for (seq = first; seq < next; seq++)
+	{
+		len = hist_get(seq, line, 0);
+		if (len != -1)
+			print_hist_entry(seq, line, len);
+	}
+	return (0);
+}
@@ -0,0 +1,124 @@
+#include "shell.h"
+
+int hist_bucket(char *s);
+size_t hist_file_size(unsigned long slots);
+unsigned long *hist_index(unsigned long *words);
+void hist_index_add(unsigned long seq, char *line, int len);
+int hist_index_scan(char *query, int *buckets, int n,
+		unsigned long seq, unsigned long next);
+
+/**
+ * hist_bucket - Hashes a character pair into a search index bitmap.
+ * @s: The first character of the pair.
+ *
+ * Return: The bitmap, below HIST_INDEX_BITS.
+ */
+int hist_bucket(char *s)
+{
+	unsigned int pair = (unsigned char)s[0] << 8 | (unsigned char)s[1];
+
+	return ((pair * 2654435761U) >> HIST_INDEX_SHIFT);
+}
+
+/**
+ * hist_file_size - Computes the size of a history file.
+ * @slots: The number of slots in the ring.
+ *
+ * Return: The size in bytes.
+ */
+size_t hist_file_size(unsigned long slots)
+{
+	return (sizeof(hist_head_t) +
+			slots * (sizeof(long) + sizeof(hist_slot_t)) +
+			HIST_INDEX_BITS * ((slots + 63) / 64) * sizeof(long));
+}
+
+/**
+ * hist_index - Locates the search index in the history file.
+ * @words: Set to the number of words in each bitmap.
+ *
+ * Return: The first word of the index.
+ */
+unsigned long *hist_index(unsigned long *words)
+{
+	unsigned long slots = hist_map->slots;
+	unsigned long *sigs = (unsigned long *)(hist_map + 1);
+
+	*words = (slots + 63) / 64;
+	return ((unsigned long *)((hist_slot_t *)(sigs + slots) + slots));
+}
+
+/**
+ * hist_index_add - Adds a history entry to the search index.
+ * @seq: The sequence number of the entry.
+ * @line: The text of the entry.
+ * @len: The length of line.
+ *
+ * Description: The bits left by the entry the slot held before are
+ *              cleared first. Other shells write other slots, possibly
+ *              in the same words, so every change is atomic.
+ */
+void hist_index_add(unsigned long seq, char *line, int len)
+{
+	unsigned long words, *idx = hist_index(&words), *word;
+	unsigned long pos = seq % hist_map->slots, bit = 1UL << pos % 64;
+	int i;
+
+	idx += pos / 64;
+	for (i = 0; i < HIST_INDEX_BITS; i++)
+		if (idx[i * words] & bit)
+			__sync_fetch_and_and(&idx[i * words], ~bit);
+	for (i = 0; i + 1 < len; i++)
+	{
+		word = &idx[hist_bucket(line + i) * words];
+		if (!(*word & bit))
+			__sync_fetch_and_or(word, bit);
+	}
+}
+
+/**
+ * hist_index_scan - Prints the indexed history entries containing a string.
+ * @query: The string.
+ * @buckets: The bitmaps of the string's bigrams.
+ * @n: The number of bitmaps.
+ * @seq: The first sequence number to search.
+ * @next: One past the last sequence number to search.
+ *
+ * Return: If nothing matched - 1.
+ *         Otherwise - 0.
+ *
+ * Description: Each step covers the slots of one index word, up to the
+ *              end of the ring, and only the slots whose bit survives
+ *              the AND of every bitmap are copied out and compared.
+ */
+int hist_index_scan(char *query, int *buckets, int n,
+		unsigned long seq, unsigned long next)
+{
+	unsigned long words, *idx = hist_index(&words), pos, step, acc;
+	char line[HIST_LINE];
+	int i, len, ret = 1;
+
+	for (; seq < next; seq += step)
+	{
+		pos = seq % hist_map->slots;
+		step = 64 - pos % 64;
+		if (step > hist_map->slots - pos)
+			step = hist_map->slots - pos;
+		if (step > next - seq)
+			step = next - seq;
+		acc = (step == 64 ? ~0UL : (1UL << step) - 1) << pos % 64;
+		for (i = 0; i < n && acc; i++)
+			acc &= idx[buckets[i] * words + pos / 64];
+		for (; acc; acc &= acc - 1)
+		{
+			i = __builtin_ctzl(acc) - pos % 64;
+			len = hist_get(seq + i, line, 0);
+			if (len != -1 && _strstr(line, query))
+			{
+				print_hist_entry(seq + i, line, len);
+				ret = 0;
+			}
+		}
+	}
+	return (ret);
+}
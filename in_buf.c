@@ -0,0 +1,144 @@
+#include "shell.h"
+
+int in_block(void);
+void in_sync(void);
+ssize_t in_fill(void);
+int in_append(char **line, size_t *used, size_t *size, char c);
+ssize_t in_getline(char **lineptr, size_t *n);
+
+static char in_blk[2][URING_BLOCK];
+static int in_mode = -1, in_cur, in_ahead;
+static off_t in_start;
+static size_t in_len, in_pos;
+
+/**
+ * in_block - Checks whether standard input is read in blocks.
+ *
+ * Return: 1 if standard input is a regular file, otherwise 0.
+ */
+int in_block(void)
+{
+	struct stat st;
+
+	if (in_mode == -1)
+		in_mode = fstat(STDIN_FILENO, &st) == 0 && S_ISREG(st.st_mode);
+	return (in_mode);
+}
+
+/**
+ * in_sync - Discards the buffered input if a command moved the position
+ *           of standard input.
+ *
+ * Description: The position of standard input is kept just after the
+ *              last line returned, so a command that reads standard input
+ *              continues from there, and the shell continues from wherever
+ *              that command stopped.
+ */
+void in_sync(void)
+{
+	off_t pos = lseek(STDIN_FILENO, 0, SEEK_CUR);
+
+	if (pos == (off_t)(in_start + in_pos))
+		return;
+	if (in_ahead)
+		uring_read_done();
+	in_ahead = 0;
+	in_start = pos;
+	in_len = in_pos = 0;
+}
+
+/**
+ * in_fill - Replaces the buffered block with the next one.
+ *
+ * Return: The number of bytes in the new block, 0 at end-of-file or -1 on
+ *         error.
+ *
+ * Description: With io_uring, the next block is already being read while
+ *              the commands of the current one run, and reading the block
+ *              after it is started right away. Otherwise it is read with
+ *              pread(2).
+ */
+ssize_t in_fill(void)
+{
+	ssize_t got;
+
+	in_start += in_len;
+	in_pos = in_len = 0;
+	if (in_ahead)
+	{
+		in_ahead = 0;
+		in_cur ^= 1;
+		got = uring_read_done();
+	}
+	else
+		got = pread(STDIN_FILENO, in_blk[in_cur], URING_BLOCK,
+			    in_start);
+	if (got <= 0)
+		return (got);
+	in_len = got;
+	in_ahead = !uring_read_ahead(STDIN_FILENO, in_blk[in_cur ^ 1],
+				     URING_BLOCK, in_start + in_len);
+	return (got);
+}
+
+/**
+ * in_append - Appends a character to a growing line.
+ * @line: The line.
+ * @used: The number of characters in the line.
+ * @size: The allocated size of the line.
+ * @c: The character.
+ *
+ * Return: If an error occurs - -1.
+ *         Otherwise - 0.
+ */
+int in_append(char **line, size_t *used, size_t *size, char c)
+{
+	if (*used + 1 >= *size)
+	{
+		*line = _realloc(*line, *size, *size * 2);
+		if (!*line)
+			return (-1);
+		*size *= 2;
+	}
+	(*line)[(*used)++] = c;
+	return (0);
+}
+
+/**
+ * in_getline - Reads a line from standard input when it is a regular file.
+ * @lineptr: Where to store the malloc'd line, including its newline.
+ * @n: Where to store the size of the line buffer.
+ *
+ * Return: The length of the line, or -1 at end-of-file or on error.
+ *
+ * Description: The file is read a block at a time instead of a byte at a
+ *              time, then its position is set back to the end of the
+ *              line, so commands see the same input as before.
+ */
+ssize_t in_getline(char **lineptr, size_t *n)
+{
+	size_t used = 0, size = 120;
+	char *line = malloc(size), c = 0;
+
+	if (!line)
+		return (-1);
+	in_sync();
+	while (c != '\n')
+	{
+		if (in_pos == in_len && in_fill() <= 0)
+			break;
+		c = in_blk[in_cur][in_pos++];
+		if (in_append(&line, &used, &size, c) == -1)
+			return (-1);
+	}
+	if (!used || (c != '\n' && in_append(&line, &used, &size, '\n')))
+	{
+		free(line);
+		return (-1);
+	}
+	line[used] = '\0';
+	lseek(STDIN_FILENO, in_start + in_pos, SEEK_SET);
+	*lineptr = line;
+	*n = size;
+	return (used);
+}
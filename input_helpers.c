@@ -1,10 +1,10 @@
 #include "shell.h"
 
 char *get_args(char *line, int *exe_ret);
-int call_args(char **args, char **front, int *exe_ret);
+char *get_more(char *line);
 int run_args(char **args, char **front, int *exe_ret);
+int run_func(node_t *body, char **cmd, int *exe_ret, int limited);
 int handle_args(int *exe_ret);
-int check_args(char **args);
 
 /**
  * get_args - Gets a command from standard input.
@@ -13,90 +13,81 @@ int check_args(char **args);
  *
  * Return: If an error occurs - NULL.
  *         Otherwise - a pointer to the stored command.
+ *
+ * Description: Builtin output is buffered across commands. It is written
+ *              out before reading, unless standard input is a regular
+ *              file, so it is never held back while the shell waits.
  */
 char *get_args(char *line, int *exe_ret)
 {
 	size_t n = 0;
 	ssize_t read;
-	char *prompt = "$ ";
 
 	if (line)
 		free(line);
+	if (!in_block())
+		out_flush();
 
-	read = _getline(&line, &n, STDIN_FILENO);
+	if (isatty(STDIN_FILENO))
+	{
+		line = _readline("$ ");
+		read = line ? _strlen(line) : -1;
+	}
+	else
+		read = _getline(&line, &n, STDIN_FILENO);
 	if (read == -1)
 		return (NULL);
 	if (read == 1)
 	{
 		hist++;
-		if (isatty(STDIN_FILENO))
-			write(STDOUT_FILENO, prompt, 2);
 		return (get_args(line, exe_ret));
 	}
 
 	line[read - 1] = '\0';
-	variable_replacement(&line, exe_ret);
-	handle_line(&line, read);
+	if (isatty(STDIN_FILENO))
+		hist_add(line);
 
 	return (line);
 }
 
 /**
- * call_args - Partitions operators from commands and calls them.
- * @args: An array of arguments.
- * @front: A double pointer to the beginning of args.
- * @exe_ret: The return value of the parent process' last executed command.
+ * get_more - Reads another line of an incomplete command.
+ * @line: The command read so far.
  *
- * Return: The return value of the last executed command.
+ * Return: If the input ends - NULL, and line is left as it is.
+ *         Otherwise - line with a newline and the new line appended. The
+ *         old buffer is freed.
  */
-int call_args(char **args, char **front, int *exe_ret)
+char *get_more(char *line)
 {
-	int ret, index;
+	char *more = NULL, *joined;
+	size_t n = 0;
+	ssize_t read;
 
-	if (!args[0])
-		return (*exe_ret);
-	for (index = 0; args[index]; index++)
+	if (!in_block())
+		out_flush();
+	if (isatty(STDIN_FILENO))
 	{
-		if (_strncmp(args[index], "||", 2) == 0)
-		{
-			free(args[index]);
-			args[index] = NULL;
-			args = replace_aliases(args);
-			ret = run_args(args, front, exe_ret);
-			if (*exe_ret != 0)
-			{
-				args = &args[++index];
-				index = 0;
-			}
-			else
-			{
-				for (index++; args[index]; index++)
-					free(args[index]);
-				return (ret);
-			}
-		}
-		else if (_strncmp(args[index], "&&", 2) == 0)
-		{
-			free(args[index]);
-			args[index] = NULL;
-			args = replace_aliases(args);
-			ret = run_args(args, front, exe_ret);
-			if (*exe_ret == 0)
-			{
-				args = &args[++index];
-				index = 0;
-			}
-			else
-			{
-				for (index++; args[index]; index++)
-					free(args[index]);
-				return (ret);
-			}
-		}
+		more = _readline("> ");
+		read = more ? _strlen(more) : -1;
 	}
-	args = replace_aliases(args);
-	ret = run_args(args, front, exe_ret);
-	return (ret);
+	else
+		read = _getline(&more, &n, STDIN_FILENO);
+	if (read == -1)
+		return (NULL);
+	more[read - 1] = '\0';
+	if (isatty(STDIN_FILENO))
+		hist_add(more);
+	joined = malloc(_strlen(line) + read + 1);
+	if (joined)
+	{
+		_strcpy(joined, line);
+		_strcat(joined, "\n");
+		_strcat(joined, more);
+		free(line);
+	}
+	free(more);
+	return (joined);
 }
 
 /**
@@ -106,27 +97,50 @@ int call_args(char **args, char **front, int *exe_ret)
  * @exe_ret: The return value of the parent process' last executed command.
  *
  * Return: The return value of the last executed command.
+ *
+ * Description: A command prefixed with "time", or any command while
+ *              HSH_RUSAGE_LOG is set, has its resource usage reported. A
+ *              "limit" prefix runs the command under resource limits.
+ *              The command after a prefix is looked up the way any other
+ *              is: as a function, then a builtin, then a program.
  */
 int run_args(char **args, char **front, int *exe_ret)
 {
-	int ret, i;
-	int (*builtin)(char **args, char **front);
-
-	builtin = get_builtin(args[0]);
-
-	if (builtin)
+	int ret, i, timed;
+	int (*builtin)(char **args, char **front) = NULL;
+	node_t *body;
+	char **cmd;
+	timing_t t;
+
+	timed = timing_start(args, &t);
+	i = (t.print != 0);
+	cmd = limit_start(args + i);
+	body = cmd ? func_find(cmd[0]) : NULL;
+	if (cmd && !body)
+		builtin = get_builtin(cmd[0]);
+	if (!cmd)
+		ret = *exe_ret = 2;
+	else if (body || builtin)
 	{
-		ret = builtin(args + 1, front);
+		if (body)
+			ret = run_func(body, cmd, exe_ret, cmd != args + i);
+		else
+			ret = builtin(cmd + 1, front);
+		if (ret == RETURN_LAST)
+			ret = *exe_ret;
 		if (ret != EXIT)
 			*exe_ret = ret;
 	}
 	else
 	{
-		*exe_ret = execute(args, front);
+		*exe_ret = execute(cmd, front);
 		ret = *exe_ret;
+		limit_end();
 	}
+	if (timed)
+		timing_end(&t, cmd ? cmd : args, *exe_ret, builtin || body);
 
-	hist++;
+	hist += (body == NULL);
 
 	for (i = 0; args[i]; i++)
 		free(args[i]);
@@ -135,75 +149,85 @@ int run_args(char **args, char **front, int *exe_ret)
 }
 
 /**
- * handle_args - Gets, calls, and runs the execution of a command.
- * @exe_ret: The return value of the parent process' last executed command.
+ * run_func - Runs a function named after a "time" or "limit" prefix.
+ * @body: The parsed body of the function.
+ * @cmd: The words of the call, inside the words of the whole command.
+ * @exe_ret: The return value of the last executed command.
+ * @limited: Non-zero if the call has a "limit" prefix.
  *
- * Return: If an end-of-file is read - END_OF_FILE (-2).
- *         If the input cannot be tokenized - -1.
- *         O/w - The exit value of the last executed command.
+ * Return: The return value of the function.
+ *
+ * Description: The call gets its own copy of the words, since func_call
+ *              frees them. A limited function runs in a subshell, where
+ *              the limits can be applied without binding the shell.
  */
-int handle_args(int *exe_ret)
+int run_func(node_t *body, char **cmd, int *exe_ret, int limited)
 {
-	int ret = 0, index;
-	char **args, *line = NULL, **front;
-
-	line = get_args(line, exe_ret);
-	if (!line)
-		return (END_OF_FILE);
-
-	args = _strtok(line, " ");
-	free(line);
-	if (!args)
-		return (ret);
-	if (check_args(args) != 0)
+	char **copy = argv_dup(cmd);
+	pid_t pid;
+	int ret;
+
+	if (!copy)
+		return (-1);
+	if (!limited)
+		return (func_call(body, copy, exe_ret));
+	out_flush();
+	cmdsub_pipe();
+	pid = fork();
+	if (pid == 0)
 	{
-		*exe_ret = 2;
-		free_args(args, args);
-		return (*exe_ret);
+		sig_child();
+		uring_close();
+		cmdsub_child();
+		limit_child();
+		func_call(body, copy, exe_ret);
+		out_flush();
+		_exit(*exe_ret);
 	}
-	front = args;
-
-	for (index = 0; args[index]; index++)
+	cmdsub_read();
+	free_args(copy, copy);
+	if (pid == -1)
 	{
-		if (_strncmp(args[index], ";", 1) == 0)
-		{
-			free(args[index]);
-			args[index] = NULL;
-			ret = call_args(args, front, exe_ret);
-			args = &args[++index];
-			index = 0;
-		}
+		perror("Error child:");
+		return (1);
 	}
-	if (args)
-		ret = call_args(args, front, exe_ret);
-
-	free(front);
+	ret = wait_child(pid);
+	limit_end();
 	return (ret);
 }
 
 /**
- * check_args - Checks if there are any leading ';', ';;', '&&', or '||'.
- * @args: 2D pointer to tokenized commands and arguments.
+ * handle_args - Gets, calls, and runs the execution of a command.
+ * @exe_ret: The return value of the parent process' last executed command.
  *
- * Return: If a ';', '&&', or '||' is placed at an invalid position - 2.
- *	   Otherwise - 0.
+ * Return: If an end-of-file is read - END_OF_FILE (-2).
+ *         If the input cannot be tokenized - -1.
+ *         O/w - The exit value of the last executed command.
+ *
+ * Description: Lines are read until they form complete commands, so a
+ *              loop can span several lines. When the commands are the last
+ *              of a non-interactive input, the final one is run in place
+ *              of the shell.
  */
-int check_args(char **args)
+int handle_args(int *exe_ret)
 {
-	size_t i;
-	char *cur, *nex;
+	int ret, tail, status;
+	char *line = NULL, *more;
+	node_t *tree;
 
-	for (i = 0; args[i]; i++)
+	line = get_args(line, exe_ret);
+	if (!line)
+		return (END_OF_FILE);
+	while ((status = parse_script(line, &tree)) == PARSE_MORE)
 	{
-		cur = args[i];
-		if (cur[0] == ';' || cur[0] == '&' || cur[0] == '|')
-		{
-			if (i == 0 || cur[1] == ';')
-				return (create_error(&args[i], 2));
-			nex = args[i + 1];
-			if (nex && (nex[0] == ';' || nex[0] == '&' || nex[0] == '|'))
-				return (create_error(&args[i + 1], 2));
-		}
+		more = get_more(line);
+		if (!more)
+			break;
+		line = more;
 	}
-	return (0);
+	free(line);
+
+	tail = !isatty(STDIN_FILENO) && input_at_eof();
+	ret = run_tree(tree, status, exe_ret, tail);
+	return (ret);
 }
@@ -0,0 +1,156 @@
+#include "shell.h"
+
+int limit_num(char *s, long scale, int suffix, long *out);
+long *limit_field(char *opt, long *scale);
+char **limit_start(char **args);
+void limit_child(void);
+void limit_end(void);
+
+static limit_t lim;
+
+/**
+ * limit_num - Parses a limit value of the form N[.F][K|M|G].
+ * @s: The string to parse.
+ * @scale: The number of units in one whole N.
+ * @suffix: Non-zero if a K, M or G size suffix is allowed.
+ * @out: Where to store the value.
+ *
+ * Return: If the string is not a positive value - -1.
+ *         Otherwise - 0.
+ */
+int limit_num(char *s, long scale, int suffix, long *out)
+{
+	long whole = 0, frac = 0, div = 1;
+	char *units = "KMG";
+	int i;
+
+	if (*s < '0' || *s > '9')
+		return (-1);
+	for (; *s >= '0' && *s <= '9' && whole < 1000000000L; s++)
+		whole = whole * 10 + (*s - '0');
+	if (*s == '.')
+		while (*++s >= '0' && *s <= '9' && div < 100000)
+		{
+			frac = frac * 10 + (*s - '0');
+			div *= 10;
+		}
+	for (i = 0; suffix && *s && units[i] && units[i] != (*s & ~0x20); i++)
+		;
+	if (suffix && *s && units[i])
+	{
+		scale <<= 10 * (i + 1);
+		s++;
+	}
+	*out = whole * scale + frac * scale / div;
+	return ((*s || *out <= 0) ? -1 : 0);
+}
+
+/**
+ * limit_field - Finds the limit set by an option.
+ * @opt: The option.
+ * @scale: Where to store the number of units in one whole value.
+ *
+ * Return: If the option is unknown - NULL.
+ *         Otherwise - a pointer to the limit.
+ */
+long *limit_field(char *opt, long *scale)
+{
+	*scale = 1;
+	if (_strcmp(opt, "--mem") == 0)
+		return (&lim.mem);
+	if (_strcmp(opt, "--time") == 0)
+		return (&lim.secs);
+	if (_strcmp(opt, "--nofile") == 0)
+		return (&lim.nofile);
+	*scale = CG_PERIOD;
+	if (_strcmp(opt, "--cpu") == 0)
+		return (&lim.cpu);
+	return (NULL);
+}
+
+/**
+ * limit_start - Parses a "limit" prefix and prepares its cgroup.
+ * @args: The arguments of the command.
+ *
+ * Return: If the prefix is malformed - NULL.
+ *         If the command has no prefix - args.
+ *         Otherwise - the arguments after the prefix.
+ *
+ * Description: The limits are applied in the child by limit_child, so a
+ *              limited command is never exec'd in place of the shell and
+ *              cannot be a builtin. A limited function runs in a subshell.
+ */
+char **limit_start(char **args)
+{
+	int i;
+	long *field, scale;
+
+	if (_strcmp(args[0], "limit") != 0)
+		return (args);
+	_memset(&lim, 0, sizeof(lim));
+	for (i = 1; args[i] && args[i][0] == '-'; i += 2)
+	{
+		if (_strcmp(args[i], "--") == 0)
+		{
+			i++;
+			break;
+		}
+		field = limit_field(args[i], &scale);
+		if (!field || !args[i + 1] || limit_num(args[i + 1], scale,
+						      field == &lim.mem, field))
+		{
+			print_error(ERR_LIMIT_ARG, args[i]);
+			return (NULL);
+		}
+	}
+	if (!args[i] || (get_builtin(args[i]) && !func_find(args[i])))
+	{
+		print_error(ERR_LIMIT_CMD, args[i] ? args[i] : "");
+		return (NULL);
+	}
+	lim.active = 1;
+	tail_exec = 0;
+	if (lim.mem || lim.cpu)
+		cg_create(&lim);
+	return (args + i);
+}
+
+/**
+ * limit_child - Applies the pending limits in a forked child.
+ *
+ * Description: The child first joins the cgroup leaf. Limits the leaf
+ *              could not enforce fall back to RLIMIT_AS for memory and to
+ *              CPU affinity for the CPU share.
+ */
+void limit_child(void)
+{
+	struct rlimit rl;
+
+	if (!lim.active)
+		return;
+	if (lim.cg[0] && cg_write(lim.cg, "cgroup.procs", 0) == -1)
+		lim.cg[0] = '\0';
+	rl.rlim_cur = rl.rlim_max = lim.mem;
+	if (lim.mem && !lim.cg[0])
+		setrlimit(RLIMIT_AS, &rl);
+	rl.rlim_cur = lim.secs;
+	rl.rlim_max = lim.secs + 1;
+	if (lim.secs)
+		setrlimit(RLIMIT_CPU, &rl);
+	rl.rlim_cur = rl.rlim_max = lim.nofile;
+	if (lim.nofile)
+		setrlimit(RLIMIT_NOFILE, &rl);
+	if (lim.cpu && !lim.cg[0])
+		cpu_affinity((lim.cpu + CG_PERIOD - 1) / CG_PERIOD);
+}
+
+/**
+ * limit_end - Removes the cgroup leaf of a limited command once it has
+ *             been waited for.
+ */
+void limit_end(void)
+{
+	if (lim.active && lim.cg[0])
+		rmdir(lim.cg);
+	lim.active = 0;
+}
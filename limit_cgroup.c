@@ -0,0 +1,135 @@
+#include "shell.h"
+
+int cg_write(char *dir, char *file, long value);
+int cg_path(char *buf, size_t size);
+void cg_create(limit_t *l);
+void cpu_affinity(long cpus);
+
+/**
+ * cg_write - Writes a number to a cgroup control file.
+ * @dir: The cgroup directory.
+ * @file: The name of the control file.
+ * @value: The number to write.
+ *
+ * Return: If the file cannot be written - -1.
+ *         Otherwise - 0.
+ */
+int cg_write(char *dir, char *file, long value)
+{
+	char path[CG_PATH_MAX + 32], num[24];
+	int fd, len, ret;
+
+	_strcpy(path, dir);
+	_strcat(path, "/");
+	_strcat(path, file);
+	fd = open(path, O_WRONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (-1);
+	len = _itoa_buf(value, num);
+	ret = write(fd, num, len) == len ? 0 : -1;
+	close(fd);
+	return (ret);
+}
+
+/**
+ * cg_path - Finds the cgroup v2 directory of the shell.
+ * @buf: The buffer to store the path in.
+ * @size: The size of buf.
+ *
+ * Return: If there is no cgroup v2 hierarchy - -1.
+ *         Otherwise - the length of the path.
+ */
+int cg_path(char *buf, size_t size)
+{
+	char data[1024], *own;
+	int fd, len, i;
+
+	if (access("/sys/fs/cgroup/cgroup.controllers", F_OK) == 0)
+		_strcpy(buf, "/sys/fs/cgroup");
+	else if (access("/sys/fs/cgroup/unified/cgroup.controllers", F_OK) == 0)
+		_strcpy(buf, "/sys/fs/cgroup/unified");
+	else
+		return (-1);
+	fd = open("/proc/self/cgroup", O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (-1);
+	len = read(fd, data, sizeof(data) - 1);
+	close(fd);
+	data[len > 0 ? len : 0] = '\0';
+	own = _strstr(data, "0::/");
+	if (!own || (own != data && own[-1] != '\n'))
+		return (-1);
+	for (own += 3, i = 0; own[i] && own[i] != '\n'; i++)
+		;
+	len = _strlen(buf);
+	if ((size_t)(len + i) >= size)
+		return (-1);
+	_memcpy(buf + len, own, i);
+	buf[len + i] = '\0';
+	return (len + i);
+}
+
+/**
+ * cg_create - Creates a cgroup v2 leaf under the shell's own cgroup with
+ *             the memory and CPU limits of a command.
+ * @l: The limits. l->cg is set to the leaf, or emptied if the host does
+ *     not allow it.
+ *
+ * Description: The leaf needs the memory and cpu controllers delegated to
+ *              the shell's cgroup. Without them the leaf is removed and
+ *              the child falls back to rlimits.
+ */
+void cg_create(limit_t *l)
+{
+	char num[24];
+	int len;
+
+	len = cg_path(l->cg, CG_PATH_MAX - 48);
+	if (len == -1)
+	{
+		l->cg[0] = '\0';
+		return;
+	}
+	if (l->cg[len - 1] != '/')
+		_strcat(l->cg, "/");
+	_strcat(l->cg, "hsh-");
+	num[_itoa_buf(getpid(), num)] = '\0';
+	_strcat(l->cg, num);
+	_strcat(l->cg, "-");
+	num[_itoa_buf(hist, num)] = '\0';
+	_strcat(l->cg, num);
+	if (mkdir(l->cg, 0755) == -1)
+	{
+		l->cg[0] = '\0';
+		return;
+	}
+	if ((l->mem && cg_write(l->cg, "memory.max", l->mem) == -1) ||
+	    (l->cpu && cg_write(l->cg, "cpu.max", l->cpu) == -1))
+	{
+		rmdir(l->cg);
+		l->cg[0] = '\0';
+	}
+}
+
+/**
+ * cpu_affinity - Restricts the calling process to its first few CPUs.
+ * @cpus: The number of CPUs to keep.
+ */
+void cpu_affinity(long cpus)
+{
+	cpu_set_t set, keep;
+	int i;
+
+	if (sched_getaffinity(0, sizeof(set), &set) == -1)
+		return;
+	CPU_ZERO(&keep);
+	for (i = 0; i < CPU_SETSIZE && cpus > 0; i++)
+	{
+		if (CPU_ISSET(i, &set))
+		{
+			CPU_SET(i, &keep);
+			cpus--;
+		}
+	}
+	sched_setaffinity(0, sizeof(keep), &keep);
+}
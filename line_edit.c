@@ -0,0 +1,145 @@
+#include "shell.h"
+
+void edit_refresh(edit_t *e);
+int edit_getc(edit_t *e, char *c);
+char *_readline(char *prompt);
+
+/**
+ * edit_refresh - Redraws the prompt and the line being edited.
+ * @e: The editor state.
+ *
+ * Description: The whole line is drawn with a single write. Lines wider
+ *              than the terminal scroll horizontally around the cursor.
+ */
+void edit_refresh(edit_t *e)
+{
+	char out[EDIT_MAX + HIST_LINE + 64], *prompt = e->prompt, *buf = e->buf;
+	int n = 0, start = 0, show, plen = e->plen, len = e->len, pos = e->pos;
+
+	if (e->searching)
+	{
+		prompt = e->sprompt;
+		plen = e->splen;
+		buf = e->match;
+		len = pos = e->mlen;
+	}
+	show = e->cols - plen - 1 < 1 ? 1 : e->cols - plen - 1;
+	if (pos > show)
+		start = pos - show;
+	if (len - start < show)
+		show = len - start;
+	out[n++] = '\r';
+	_memcpy(out + n, prompt, plen);
+	n += plen;
+	_memcpy(out + n, buf + start, show);
+	n += show;
+	_memcpy(out + n, "\x1b[K\r", 4);
+	n += 4;
+	if (plen + pos - start > 0)
+	{
+		_memcpy(out + n, "\x1b[", 2);
+		n += 2;
+		n += _itoa_buf(plen + pos - start, out + n);
+		out[n++] = 'C';
+	}
+	write(STDOUT_FILENO, out, n);
+}
+
+/**
+ * edit_getc - Reads one key byte while handling signals and building the
+ *             PATH index.
+ * @e: The editor state.
+ * @c: Where to store the byte.
+ *
+ * Return: The result of read(2). A SIGINT is returned as a ^C key.
+ *
+ * Description: The terminal and the signalfd are polled together, along
+ *              with the inotify descriptor of the command lookup cache so
+ *              its events are applied while the shell is idle. While
+ *              the PATH index is incomplete, one small batch of it is built
+ *              each time neither has input, so indexing never delays a
+ *              keystroke by more than one batch. SIGWINCH redraws the line
+ *              for the new terminal width.
+ */
+int edit_getc(edit_t *e, char *c)
+{
+	struct pollfd pfd[3];
+	int ready, got, indexing = 1;
+
+	pfd[0].fd = STDIN_FILENO;
+	pfd[1].fd = sig_fd_get();
+	pfd[2].fd = path_watch_fd();
+	pfd[0].events = pfd[1].events = pfd[2].events = POLLIN;
+	while (1)
+	{
+		ready = poll(pfd, 3, indexing ? 0 : -1);
+		if (ready == 0)
+			indexing = path_index_step();
+		if (ready == 0 || (ready == -1 && errno == EINTR))
+			continue;
+		if (ready == -1)
+			break;
+		if (pfd[2].revents & POLLIN)
+			path_watch_drain();
+		if (!(pfd[1].revents & POLLIN))
+		{
+			if (pfd[0].revents)
+				break;
+			continue;
+		}
+		got = sig_read();
+		if (got & SIG_GOT_INT)
+		{
+			*c = 3;
+			return (1);
+		}
+		if (got & SIG_GOT_WINCH)
+		{
+			e->cols = term_cols();
+			edit_refresh(e);
+		}
+	}
+	return (read(STDIN_FILENO, c, 1));
+}
+
+/**
+ * _readline - Reads a line from the terminal with line editing.
+ * @prompt: The prompt to print.
+ *
+ * Return: If an end-of-file is read - NULL.
+ *         Otherwise - the malloc'd line, including its newline.
+ */
+char *_readline(char *prompt)
+{
+	edit_t e;
+	char c, *line;
+	int act = EDIT_CONTINUE;
+
+	if (edit_raw(1) == -1)
+		return (edit_fallback(prompt));
+	_memset(&e, 0, sizeof(e));
+	e.prompt = prompt;
+	e.plen = _strlen(prompt);
+	e.cols = term_cols();
+	e.hist_seq = hist_count(&e.hist_first);
+	path_index_sync();
+	edit_refresh(&e);
+	while (act == EDIT_CONTINUE)
+	{
+		if (edit_getc(&e, &c) <= 0)
+			act = EDIT_EOF;
+		else
+			act = e.searching ? search_key(&e, c) : edit_key(&e, c);
+	}
+	edit_raw(0);
+	write(STDOUT_FILENO, "\n", 1);
+	if (act == EDIT_EOF)
+		return (NULL);
+	line = malloc(e.len + 2);
+	if (!line)
+		return (NULL);
+	_memcpy(line, e.buf, e.len);
+	line[e.len] = '\n';
+	line[e.len + 1] = '\0';
+	return (line);
+}
@@ -0,0 +1,182 @@
+#include "shell.h"
+
+void edit_insert(edit_t *e, char *str, int n);
+void edit_delete(edit_t *e, int at, int n);
+void edit_history(edit_t *e, int dir);
+int edit_escape(edit_t *e);
+int edit_key(edit_t *e, char c);
+
+/**
+ * edit_insert - Inserts text at the cursor.
+ * @e: The editor state.
+ * @str: The text to insert.
+ * @n: The length of str.
+ */
+void edit_insert(edit_t *e, char *str, int n)
+{
+	int i;
+
+	if (e->len + n >= EDIT_MAX)
+		n = EDIT_MAX - 1 - e->len;
+	if (n <= 0)
+		return;
+	for (i = e->len - 1; i >= e->pos; i--)
+		e->buf[i + n] = e->buf[i];
+	_memcpy(e->buf + e->pos, str, n);
+	e->len += n;
+	e->pos += n;
+}
+
+/**
+ * edit_delete - Deletes text from the line.
+ * @e: The editor state.
+ * @at: The index of the first byte to delete.
+ * @n: The number of bytes to delete.
+ */
+void edit_delete(edit_t *e, int at, int n)
+{
+	int i;
+
+	if (at < 0 || n <= 0 || at + n > e->len)
+		return;
+	for (i = at; i + n < e->len; i++)
+		e->buf[i] = e->buf[i + n];
+	e->len -= n;
+	if (e->pos > at + n)
+		e->pos -= n;
+	else if (e->pos > at)
+		e->pos = at;
+}
+
+/**
+ * edit_history - Replaces the line with an older or newer history entry.
+ * @e: The editor state.
+ * @dir: -1 to move to an older entry, 1 to move to a newer one.
+ *
+ * Description: The line being typed is saved when browsing starts and
+ *              restored when browsing moves past the newest entry.
+ */
+void edit_history(edit_t *e, int dir)
+{
+	char line[HIST_LINE];
+	unsigned long seq = e->hist_seq, next = hist_count(&e->hist_first);
+	int len = -1;
+
+	while (len == -1 && (dir < 0 ? seq > e->hist_first : seq < next))
+	{
+		seq += dir;
+		if (seq < next)
+			len = hist_get(seq, line, 0);
+		else
+			break;
+	}
+	if (len == -1 && seq != next)
+		return;
+	if (e->hist_seq >= next)
+	{
+		_memcpy(e->saved, e->buf, e->len);
+		e->saved_len = e->len;
+	}
+	e->hist_seq = seq;
+	if (len == -1)
+	{
+		len = e->saved_len;
+		_memcpy(e->buf, e->saved, len);
+	}
+	else
+		_memcpy(e->buf, line, len);
+	e->len = len;
+	e->pos = len;
+}
+
+/**
+ * edit_escape - Handles an escape sequence sent by a cursor key.
+ * @e: The editor state.
+ *
+ * Return: EDIT_CONTINUE, or EDIT_EOF if the terminal closed.
+ */
+int edit_escape(edit_t *e)
+{
+	char seq[3];
+
+	if (edit_getc(e, &seq[0]) <= 0 || edit_getc(e, &seq[1]) <= 0)
+		return (EDIT_EOF);
+	if (seq[0] == '[' && seq[1] >= '0' && seq[1] <= '9')
+	{
+		if (edit_getc(e, &seq[2]) <= 0)
+			return (EDIT_EOF);
+		if (seq[2] == '~' && seq[1] == '3')
+			edit_delete(e, e->pos, 1);
+		else if (seq[2] == '~' && (seq[1] == '1' || seq[1] == '7'))
+			e->pos = 0;
+		else if (seq[2] == '~' && (seq[1] == '4' || seq[1] == '8'))
+			e->pos = e->len;
+	}
+	else if (seq[0] == '[' || seq[0] == 'O')
+	{
+		if (seq[1] == 'A' || seq[1] == 'B')
+			edit_history(e, seq[1] == 'A' ? -1 : 1);
+		else if (seq[1] == 'C' && e->pos < e->len)
+			e->pos++;
+		else if (seq[1] == 'D' && e->pos > 0)
+			e->pos--;
+		else if (seq[1] == 'H')
+			e->pos = 0;
+		else if (seq[1] == 'F')
+			e->pos = e->len;
+	}
+	edit_refresh(e);
+	return (EDIT_CONTINUE);
+}
+
+/**
+ * edit_key - Applies one key to the line being edited.
+ * @e: The editor state.
+ * @c: The key.
+ *
+ * Return: EDIT_ACCEPT when the line is complete, EDIT_EOF on ^D at an
+ *         empty line, otherwise EDIT_CONTINUE.
+ */
+int edit_key(edit_t *e, char c)
+{
+	int start = e->pos;
+
+	if (c == '\r' || c == '\n' || (c == 4 && e->len == 0))
+		return (c == 4 ? EDIT_EOF : EDIT_ACCEPT);
+	if (c == 27 || c == 18)
+		return (c == 27 ? edit_escape(e) : search_key(e, c));
+	if (c == 3)
+	{
+		write(STDOUT_FILENO, "^C\n", 3);
+		e->len = e->pos = 0;
+		e->hist_seq = hist_count(&e->hist_first);
+	}
+	else if (c == 9)
+		edit_complete(e);
+	else if (c == 1 || c == 5)
+		e->pos = c == 1 ? 0 : e->len;
+	else if ((c == 2 && e->pos > 0) || (c == 6 && e->pos < e->len))
+		e->pos += c == 2 ? -1 : 1;
+	else if (c == 4 || c == 127 || c == 8)
+		edit_delete(e, c == 4 ? e->pos : e->pos - 1, 1);
+	else if (c == 11)
+		edit_delete(e, e->pos, e->len - e->pos);
+	else if (c == 21)
+		edit_delete(e, 0, e->pos);
+	else if (c == 23)
+	{
+		while (start > 0 && e->buf[start - 1] == ' ')
+			start--;
+		while (start > 0 && e->buf[start - 1] != ' ')
+			start--;
+		edit_delete(e, start, e->pos - start);
+	}
+	else if (c == 16 || c == 14)
+		edit_history(e, c == 16 ? -1 : 1);
+	else if (c == 12)
+		write(STDOUT_FILENO, "\x1b[H\x1b[2J", 7);
+	else if ((unsigned char)c >= 32)
+		edit_insert(e, &c, 1);
+	edit_refresh(e);
+	return (EDIT_CONTINUE);
+}
@@ -0,0 +1,68 @@
+#include "shell.h"
+
+int edit_raw(int on);
+int term_cols(void);
+char *edit_fallback(char *prompt);
+
+/**
+ * edit_raw - Switches the terminal in and out of raw mode.
+ * @on: Non-zero to enter raw mode, zero to restore the saved settings.
+ *
+ * Return: If the terminal cannot be switched - -1.
+ *         Otherwise - 0.
+ *
+ * Description: Output processing is kept so that '\n' still moves to the
+ *              start of the next line. Switching waits for output to drain
+ *              but keeps unread input, so lines typed ahead or pasted
+ *              are read once the current one is done.
+ */
+int edit_raw(int on)
+{
+	static struct termios orig;
+	struct termios raw;
+
+	if (!on)
+		return (tcsetattr(STDIN_FILENO, TCSADRAIN, &orig));
+	if (tcgetattr(STDIN_FILENO, &orig) == -1)
+		return (-1);
+	raw = orig;
+	raw.c_iflag &= ~(BRKINT | ICRNL | INPCK | ISTRIP | IXON);
+	raw.c_lflag &= ~(ECHO | ICANON | IEXTEN | ISIG);
+	raw.c_cc[VMIN] = 1;
+	raw.c_cc[VTIME] = 0;
+	return (tcsetattr(STDIN_FILENO, TCSADRAIN, &raw));
+}
+
+/**
+ * term_cols - Gets the width of the terminal.
+ *
+ * Return: The number of columns, or 80 if it cannot be determined.
+ */
+int term_cols(void)
+{
+	struct winsize ws;
+
+	if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0 && ws.ws_col > 0)
+		return (ws.ws_col);
+	return (80);
+}
+
+/**
+ * edit_fallback - Reads a line without editing when the terminal cannot
+ *                 be put in raw mode.
+ * @prompt: The prompt to print.
+ *
+ * Return: If an end-of-file is read - NULL.
+ *         Otherwise - the line, including its newline.
+ */
+char *edit_fallback(char *prompt)
+{
+	char *line = NULL;
+	size_t n = 0;
+
+	write(STDOUT_FILENO, prompt, _strlen(prompt));
+	if (_getline(&line, &n, stdin) != -1)
+		return (line);
+	write(STDOUT_FILENO, "\n", 1);
+	return (NULL);
+}
@@ -0,0 +1,124 @@
+#include "shell.h"
+
+void search_find(edit_t *e, unsigned long from);
+void search_prompt(edit_t *e);
+void search_end(edit_t *e, int keep);
+int search_key(edit_t *e, char c);
+
+/**
+ * search_find - Finds the newest history entry containing the query.
+ * @e: The editor state.
+ * @from: One past the newest sequence number to consider.
+ *
+ * Description: Entries are screened by bigram signature before their
+ *              text is compared, so each keystroke scans the ring cheaply.
+ */
+void search_find(edit_t *e, unsigned long from)
+{
+	char line[HIST_LINE];
+	unsigned long sig = hist_sig(e->query, e->qlen);
+	int len;
+
+	e->query[e->qlen] = '\0';
+	hist_count(&e->hist_first);
+	while (from > e->hist_first)
+	{
+		from--;
+		len = hist_get(from, line, sig);
+		if (len != -1 && _strstr(line, e->query))
+		{
+			_memcpy(e->match, line, len);
+			e->mlen = len;
+			e->match_seq = from;
+			e->found = 1;
+			return;
+		}
+	}
+	e->found = 0;
+}
+
+/**
+ * search_prompt - Builds the reverse-i-search prompt for the query.
+ * @e: The editor state.
+ */
+void search_prompt(edit_t *e)
+{
+	char *head = e->found || !e->qlen ? "(reverse-i-search)`" :
+		"(failed reverse-i-search)`";
+
+	e->sprompt[0] = '\0';
+	_strcat(e->sprompt, head);
+	_strncat(e->sprompt, e->query, e->qlen);
+	_strcat(e->sprompt, "': ");
+	e->splen = _strlen(e->sprompt);
+	if (!e->found)
+		e->mlen = 0;
+}
+
+/**
+ * search_end - Leaves search mode.
+ * @e: The editor state.
+ * @keep: Non-zero to copy the current match into the line.
+ */
+void search_end(edit_t *e, int keep)
+{
+	e->searching = 0;
+	if (keep && e->found)
+	{
+		_memcpy(e->buf, e->match, e->mlen);
+		e->len = e->pos = e->mlen;
+		e->hist_seq = e->match_seq;
+	}
+	edit_refresh(e);
+}
+
+/**
+ * search_key - Applies one key during a ^R incremental history search.
+ * @e: The editor state.
+ * @c: The key.
+ *
+ * Return: EDIT_ACCEPT when Enter runs the match, otherwise the result of
+ *         handling the key.
+ *
+ * Description: Typed characters extend the query, ^R moves to an older
+ *              match, ^G cancels. Any other key keeps the match and is
+ *              then handled as a normal editing key.
+ */
+int search_key(edit_t *e, char c)
+{
+	unsigned long next = hist_count(&e->hist_first);
+
+	if (!e->searching)
+	{
+		e->searching = 1;
+		e->qlen = e->mlen = e->found = 0;
+		e->match_seq = next;
+	}
+	else if (c == 18)
+		search_find(e, e->found ? e->match_seq : next);
+	else if ((c == 127 || c == 8) && e->qlen > 0)
+	{
+		e->qlen--;
+		search_find(e, next);
+	}
+	else if ((unsigned char)c >= 32 && e->qlen < HIST_LINE - 1)
+	{
+		e->query[e->qlen++] = c;
+		search_find(e, e->found ? e->match_seq + 1 : next);
+	}
+	else if (c == 7)
+	{
+		search_end(e, 0);
+		return (EDIT_CONTINUE);
+	}
+	else if (c != 127 && c != 8)
+	{
+		search_end(e, 1);
+		if (c == '\r' || c == '\n')
+			return (EDIT_ACCEPT);
+		return (edit_key(e, c));
+	}
+	search_prompt(e);
+	edit_refresh(e);
+	return (EDIT_CONTINUE);
+}
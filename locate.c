@@ -9,43 +9,36 @@ list_t *get_path_dir(char *path);
  *
  * Return: If an error occurs or the command cannot be located - NULL.
  *         Otherwise - the full pathname of the command.
+ *
+ * Description: Commands found missing are remembered until PATH, PWD or
+ *              one of the PATH directories changes, so probing for an
+ *              absent tool does not search every directory again. While
+ *              the directories are watched, found commands are remembered
+ *              as well.
  */
 char *get_location(char *command)
 {
 	char **path, *temp;
-	list_t *dirs, *head;
-	struct stat st;
+	list_t *dirs;
+	path_ent_t *ent;
+	path_cache_t *pc = path_cache();
 
+	pc->exec_fd = pc->exec_dir = -1;
 	path = _getenv("PATH");
 	if (!path || !(*path))
 		return (NULL);
 
-	dirs = get_path_dir(*path + 5);
-	head = dirs;
-
-	while (dirs)
-	{
-		temp = malloc(_strlen(dirs->dir) + _strlen(command) + 2);
-		if (!temp)
-			return (NULL);
-
-		_strcpy(temp, dirs->dir);
-		_strcat(temp, "/");
-		_strcat(temp, command);
-
-		if (stat(temp, &st) == 0)
-		{
-			free_list(head);
-			return (temp);
-		}
-
-		dirs = dirs->next;
-		free(temp);
-	}
-
-	free_list(head);
-
-	return (NULL);
+	dirs = path_cache_sync(*path + 5);
+	path_cache_check(command);
+	ent = path_cache_find(command, NULL, 0);
+	if (!ent)
+		return (path_search(dirs, command));
+	if (!ent->path)
+		return (NULL);
+	temp = malloc(_strlen(ent->path) + 1);
+	if (temp)
+		pc->exec_fd = ent->fd;
+	return (temp ? _strcpy(temp, ent->path) : NULL);
 }
 
 /**
@@ -0,0 +1,74 @@
+#include "shell.h"
+
+int shellby_break(char **args, char __attribute__((__unused__)) **front);
+int shellby_continue(char **args, char __attribute__((__unused__)) **front);
+int loop_arg(char *arg, int err);
+
+/**
+ * shellby_break - Leaves the innermost loops.
+ * @args: An array of arguments. args[0], if given, is the number of
+ *        loops to leave.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If the number is invalid - 2.
+ *         Otherwise - 0. Outside of a loop nothing happens.
+ */
+int shellby_break(char **args, char __attribute__((__unused__)) **front)
+{
+	int n = loop_arg(args[0], ERR_BREAK_NUM);
+
+	if (n < 0)
+		return (2);
+	loop_break = n < loop_depth ? n : loop_depth;
+	loop_cont = 0;
+	return (0);
+}
+
+/**
+ * shellby_continue - Skips to the next pass of a loop.
+ * @args: An array of arguments. args[0], if given, is the number of the
+ *        enclosing loop to continue, 1 being the innermost.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If the number is invalid - 2.
+ *         Otherwise - 0. Outside of a loop nothing happens.
+ *
+ * Description: The loops inside the one that continues are left, the
+ *              same way break leaves them.
+ */
+int shellby_continue(char **args, char __attribute__((__unused__)) **front)
+{
+	int n = loop_arg(args[0], ERR_CONT_NUM);
+
+	if (n < 0)
+		return (2);
+	if (!loop_depth)
+		return (0);
+	loop_break = (n < loop_depth ? n : loop_depth) - 1;
+	loop_cont = 1;
+	return (0);
+}
+
+/**
+ * loop_arg - Converts the loop count given to break or continue.
+ * @arg: The count, or NULL for 1.
+ * @err: The ERR_* index of the message printed if the count is invalid.
+ *
+ * Return: The count, or -1 if it is not a positive number.
+ */
+int loop_arg(char *arg, int err)
+{
+	long n = 0;
+	int i;
+
+	if (!arg)
+		return (1);
+	for (i = 0; arg[i] >= '0' && arg[i] <= '9'; i++)
+		n = n < 100000 ? n * 10 + (arg[i] - '0') : n;
+	if (arg[i] || !n)
+	{
+		print_error(err, arg);
+		return (-1);
+	}
+	return (n);
+}
@@ -1,20 +1,7 @@
 #include "shell.h"
 
-void sig_handler(int sig);
 int execute(char **args, char **front);
-
-/**
- * sig_handler - Prints a new prompt upon a signal.
- * @sig: The signal.
- */
-void sig_handler(int sig)
-{
-	char *new_prompt = "\n$ ";
-
-	(void)sig;
-	signal(SIGINT, sig_handler);
-	write(STDIN_FILENO, new_prompt, 3);
-}
+void free_shell(void);
 
 /**
  * execute - Executes a command in a child process.
@@ -27,7 +14,7 @@ void sig_handler(int sig)
 int execute(char **args, char **front)
 {
 	pid_t child_pid;
-	int status, flag = 0, ret = 0;
+	int flag = 0, ret = 0;
 	char *command = args[0];
 
 	if (command[0] != '/' && command[0] != '.')
@@ -36,16 +23,24 @@ int execute(char **args, char **front)
 		command = get_location(command);
 	}
 
-	if (!command || (access(command, F_OK) == -1))
+	if (!command || (!flag && access(command, F_OK) == -1))
 	{
 		if (errno == EACCES)
 			ret = (create_error(args, 126));
 		else
 			ret = (create_error(args, 127));
 	}
+	else if (!argv_fits(args))
+		ret = 126;
 	else
 	{
+		out_flush();
+		if (tail_exec)
+			path_execve(command, args, flag);
+		cmdsub_pipe();
 		child_pid = fork();
+		if (child_pid != 0)
+			cmdsub_read();
 		if (child_pid == -1)
 		{
 			if (flag)
@@ -55,25 +50,44 @@ int execute(char **args, char **front)
 		}
 		if (child_pid == 0)
 		{
-			execve(command, args, environ);
+			sig_child();
+			cmdsub_child();
+			limit_child();
+			path_execve(command, args, flag);
 			if (errno == EACCES)
 				ret = (create_error(args, 126));
-			free_env();
 			free_args(args, front);
-			free_alias_list(aliases);
+			free_shell();
 			_exit(ret);
 		}
 		else
-		{
-			wait(&status);
-			ret = WEXITSTATUS(status);
-		}
+			ret = wait_child(child_pid);
+		stat_cache_reset();
 	}
 	if (flag)
 		free(command);
 	return (ret);
 }
 
+/**
+ * free_shell - Writes pending builtin output and releases the environment,
+ *              aliases, functions, history mapping, PATH index and command
+ *              lookup cache before the shell exits.
+ */
+void free_shell(void)
+{
+	out_flush();
+	free_env();
+	free_alias_list(aliases);
+	hist_close();
+	path_index_free();
+	path_cache_free();
+	path_pool_size(0);
+	uring_close();
+	arith_cache_free();
+	func_free_all();
+}
+
 /**
  * main - Runs a simple UNIX command interpreter.
  * @argc: The number of arguments supplied to the program.
@@ -85,23 +99,22 @@ int main(int argc, char *argv[])
 {
 	int ret = 0, retn;
 	int *exe_ret = &retn;
-	char *prompt = "$ ", *new_line = "\n";
 
 	name = argv[0];
 	hist = 1;
 	aliases = NULL;
-	signal(SIGINT, sig_handler);
 
 	*exe_ret = 0;
-	environ = _copyenv();
-	if (!environ)
-		exit(-100);
 
 	if (argc != 1)
 	{
-		ret = proc_file_commands(argv[1], exe_ret);
-		free_env();
-		free_alias_list(aliases);
+		pos_args = argv + 2;
+		pos_count = argc - 2;
+		if (_strcmp(argv[1], "-c") == 0)
+			ret = proc_string_commands(argv + 2, exe_ret);
+		else
+			ret = proc_file_commands(argv[1], exe_ret);
+		free_shell();
 		return (*exe_ret);
 	}
 
@@ -109,26 +122,22 @@ int main(int argc, char *argv[])
 	{
 		while (ret != END_OF_FILE && ret != EXIT)
 			ret = handle_args(exe_ret);
-		free_env();
-		free_alias_list(aliases);
+		free_shell();
 		return (*exe_ret);
 	}
 
+	hist_open();
+	sig_init();
 	while (1)
 	{
-		write(STDOUT_FILENO, prompt, 2);
 		ret = handle_args(exe_ret);
 		if (ret == END_OF_FILE || ret == EXIT)
 		{
-			if (ret == END_OF_FILE)
-				write(STDOUT_FILENO, new_line, 1);
-			free_env();
-			free_alias_list(aliases);
+			free_shell();
 			exit(*exe_ret);
 		}
 	}
 
-	free_env();
-	free_alias_list(aliases);
+	free_shell();
 	return (*exe_ret);
 }
@@ -1,9 +1,31 @@
 #include "shell.h"
 int (*get_builtin(char *command))(char **args, char **front);
+char *builtin_name(int index);
 int shellby_exit(char **args, char **front);
 int shellby_cd(char **args, char __attribute__((__unused__)) **front);
 int shellby_help(char **args, char __attribute__((__unused__)) **front);
 
+static builtin_t builtins[] = {
+	{ "exit", shellby_exit },
+	{ "env", shellby_env },
+	{ "setenv", shellby_setenv },
+	{ "unsetenv", shellby_unsetenv },
+	{ "cd", shellby_cd },
+	{ "alias", shellby_alias },
+	{ "help", shellby_help },
+	{ "history", shellby_history },
+	{ "echo", shellby_echo },
+	{ "printf", shellby_printf },
+	{ "test", shellby_test },
+	{ "[", shellby_bracket },
+	{ "break", shellby_break },
+	{ "continue", shellby_continue },
+	{ "return", shellby_return },
+	{ "local", shellby_local },
+	{ "xargs", shellby_xargs },
+	{ NULL, NULL }
+};
+
 /**
  * get_builtin - Matches a command with a corresponding
  *               shellby builtin function.
@@ -13,24 +35,30 @@ int shellby_help(char **args, char __attribute__((__unused__)) **front);
  */
 int (*get_builtin(char *command))(char **args, char **front)
 {
-	builtin_t funcs[] = {
-		{ "exit", shellby_exit },
-		{ "env", shellby_env },
-		{ "setenv", shellby_setenv },
-		{ "unsetenv", shellby_unsetenv },
-		{ "cd", shellby_cd },
-		{ "alias", shellby_alias },
-		{ "help", shellby_help },
-		{ NULL, NULL }
-	};
 	int i;
 
-	for (i = 0; funcs[i].name; i++)
+	for (i = 0; builtins[i].name; i++)
 	{
-		if (_strcmp(funcs[i].name, command) == 0)
+		if (_strcmp(builtins[i].name, command) == 0)
 			break;
 	}
-	return (funcs[i].f);
+	return (builtins[i].f);
+}
+
+/**
+ * builtin_name - Gets the name of a builtin by its position in the table.
+ * @index: The position.
+ *
+ * Return: If index is past the end of the table - NULL.
+ *         Otherwise - the builtin's name.
+ */
+char *builtin_name(int index)
+{
+	int i;
+
+	for (i = 0; i < index && builtins[i].name; i++)
+		;
+	return (builtins[i].name);
 }
 
 /**
@@ -47,7 +75,7 @@ int (*get_builtin(char *command))(char **args, char **front)
  */
 int shellby_exit(char **args, char **front)
 {
-	int i, len_of_int = 10;
+	int i = 0, len_of_int = 10;
 	unsigned int num = 0, max = 1 << (sizeof(int) * 8 - 1);
 
 	if (args[0])
@@ -73,8 +101,7 @@ int shellby_exit(char **args, char **front)
 		return (create_error(--args, 2));
 	args -= 1;
 	free_args(args, front);
-	free_env();
-	free_alias_list(aliases);
+	free_shell();
 	exit(num);
 }
 
@@ -150,8 +177,8 @@ int shellby_cd(char **args, char __attribute__((__unused__)) **front)
 		return (-1);
 	if (args[0] && args[0][0] == '-' && args[0][1] != '-')
 	{
-		write(STDOUT_FILENO, pwd, _strlen(pwd));
-		write(STDOUT_FILENO, new_line, 1);
+		out_puts(pwd);
+		out_puts(new_line);
 	}
 	free(oldpwd);
 	free(pwd);
@@ -185,7 +212,19 @@ int shellby_help(char **args, char __attribute__((__unused__)) **front)
 		help_unsetenv();
 	else if (_strcmp(args[0], "help") == 0)
 		help_help();
-	else
+	else if (_strcmp(args[0], "history") == 0)
+		help_history();
+	else if (_strcmp(args[0], "time") == 0)
+		help_time();
+	else if (_strcmp(args[0], "limit") == 0)
+		help_limit();
+	else if (_strcmp(args[0], "echo") == 0)
+		help_echo();
+	else if (_strcmp(args[0], "printf") == 0)
+		help_printf();
+	else if (_strcmp(args[0], "test") == 0 || _strcmp(args[0], "[") == 0)
+		help_test();
+	else if (!help_more(args[0]))
 		write(STDERR_FILENO, name, _strlen(name));
 
 	return (0);
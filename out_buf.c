@@ -0,0 +1,117 @@
+#include "shell.h"
+
+void out_flush(void);
+void writev_all(int fd, struct iovec *iov, int cnt);
+void out_writev(struct iovec *iov, int cnt);
+void out_write(char *str, size_t len);
+void out_puts(char *str);
+
+static char out_buf[OUT_BUF_SIZE];
+static size_t out_used;
+
+/**
+ * out_flush - Writes any buffered builtin output to standard output.
+ */
+void out_flush(void)
+{
+	struct iovec iov;
+
+	if (!out_used)
+		return;
+	iov.iov_base = out_buf;
+	iov.iov_len = out_used;
+	out_used = 0;
+	writev_all(STDOUT_FILENO, &iov, 1);
+}
+
+/**
+ * writev_all - Writes a scatter list, retrying after short writes.
+ * @fd: The file descriptor to write to.
+ * @iov: The scatter list. Entries are consumed as they are written.
+ * @cnt: The number of entries in iov.
+ */
+void writev_all(int fd, struct iovec *iov, int cnt)
+{
+	ssize_t wrote;
+
+	while (cnt > 0)
+	{
+		wrote = uring_writev(fd, iov, cnt);
+		if (wrote == -1 && errno == EINTR)
+			continue;
+		if (wrote <= 0)
+			return;
+		while (cnt > 0 && (size_t)wrote >= iov->iov_len)
+		{
+			wrote -= iov->iov_len;
+			iov++;
+			cnt--;
+		}
+		if (cnt > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + wrote;
+			iov->iov_len -= wrote;
+		}
+	}
+}
+
+/**
+ * out_writev - Appends a scatter list to the builtin output buffer.
+ * @iov: The pieces to write.
+ * @cnt: The number of pieces (at most OUT_IOV_MAX).
+ *
+ * Description: Pieces are copied into the buffer while they fit. When they
+ *              do not, the buffer and the pieces go out in one writev.
+ *              Inside a command substitution they are captured instead.
+ */
+void out_writev(struct iovec *iov, int cnt)
+{
+	struct iovec vec[OUT_IOV_MAX + 1];
+	size_t total = 0;
+	int i;
+
+	for (i = 0; cmdsub_out && i < cnt; i++)
+		cmdsub_add(cmdsub_out, iov[i].iov_base, iov[i].iov_len);
+	if (cmdsub_out)
+		return;
+	for (i = 0; i < cnt; i++)
+		total += iov[i].iov_len;
+	if (out_used + total > OUT_BUF_SIZE)
+	{
+		vec[0].iov_base = out_buf;
+		vec[0].iov_len = out_used;
+		for (i = 0; i < cnt; i++)
+			vec[i + 1] = iov[i];
+		out_used = 0;
+		writev_all(STDOUT_FILENO, vec, cnt + 1);
+		return;
+	}
+	for (i = 0; i < cnt; i++)
+	{
+		_memcpy(out_buf + out_used, iov[i].iov_base, iov[i].iov_len);
+		out_used += iov[i].iov_len;
+	}
+}
+
+/**
+ * out_write - Appends bytes to the builtin output buffer.
+ * @str: The bytes to write.
+ * @len: The number of bytes.
+ */
+void out_write(char *str, size_t len)
+{
+	struct iovec iov;
+
+	iov.iov_base = str;
+	iov.iov_len = len;
+	out_writev(&iov, 1);
+}
+
+/**
+ * out_puts - Appends a string to the builtin output buffer.
+ * @str: The string to write.
+ */
+void out_puts(char *str)
+{
+	out_write(str, _strlen(str));
+}
@@ -0,0 +1,65 @@
+#include "shell.h"
+
+char *param_value(char c, int *exe_ret);
+char *param_join(void);
+
+/**
+ * param_value - Gets the value of a special parameter.
+ * @c: The character after the '$': '$' for the process ID, '?' for the
+ *     last return value, '#' for the number of positional parameters,
+ *     '@' or '*' for all of them, or a digit for one of them, '0' being
+ *     the shell's name.
+ * @exe_ret: A pointer to the return value of the last executed command.
+ *
+ * Return: The malloc'd value, or NULL if it is empty.
+ */
+char *param_value(char c, int *exe_ret)
+{
+	char *value, *src;
+
+	if (c == '$')
+		return (get_pid());
+	if (c == '?')
+		return (_itoa(*exe_ret));
+	if (c == '#')
+		return (_itoa(pos_count));
+	if (c == '@' || c == '*')
+		return (param_join());
+	if (c == '0')
+		src = name;
+	else if (c - '0' <= pos_count)
+		src = pos_args[c - '1'];
+	else
+		return (NULL);
+	value = malloc(_strlen(src) + 1);
+	if (value)
+		_strcpy(value, src);
+	return (value);
+}
+
+/**
+ * param_join - Joins the positional parameters with spaces.
+ *
+ * Return: The malloc'd result, or NULL if there are no parameters.
+ */
+char *param_join(void)
+{
+	char *value;
+	int i, len = 0;
+
+	if (!pos_count)
+		return (NULL);
+	for (i = 0; i < pos_count; i++)
+		len += _strlen(pos_args[i]) + 1;
+	value = malloc(len);
+	if (!value)
+		return (NULL);
+	value[0] = '\0';
+	for (i = 0; i < pos_count; i++)
+	{
+		if (i)
+			_strcat(value, " ");
+		_strcat(value, pos_args[i]);
+	}
+	return (value);
+}
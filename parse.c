@@ -0,0 +1,158 @@
+#include "shell.h"
+
+int parse_script(char *line, node_t **tree);
+node_t *parse_list(parse_t *ps);
+node_t *parse_and_or(parse_t *ps);
+node_t *parse_command(parse_t *ps);
+node_t *parse_simple(parse_t *ps);
+
+/**
+ * parse_script - Parses commands into a tree.
+ * @line: The commands. Newlines separate commands like ';'.
+ * @tree: Where to store the first command, or NULL if there is none or
+ *        the commands could not be parsed.
+ *
+ * Return: PARSE_OK on success.
+ *         PARSE_MORE if the commands are incomplete, such as a "while"
+ *         without its "done".
+ *         PARSE_ERR after printing a syntax error.
+ */
+int parse_script(char *line, node_t **tree)
+{
+	parse_t ps;
+
+	ps.p = line;
+	ps.status = PARSE_OK;
+	ps.npending = 0;
+	*tree = NULL;
+	lex_next(&ps, 0);
+	parse_linebreak(&ps);
+	if (ps.tok != T_END)
+		*tree = parse_list(&ps);
+	if (ps.tok != T_END)
+		parse_error(&ps);
+	if (ps.npending && !ps.status)
+		ps.status = PARSE_MORE;
+	if (ps.status)
+	{
+		tree_free(*tree);
+		*tree = NULL;
+	}
+	return (ps.status);
+}
+
+/**
+ * parse_list - Parses and-or lists separated by ';' or newlines.
+ * @ps: The parser state.
+ *
+ * Return: The first command of the list. The rest are linked through
+ *         next.
+ *
+ * Description: The list stops before anything that cannot start a
+ *              command, such as "done", so that the caller can check it.
+ */
+node_t *parse_list(parse_t *ps)
+{
+	node_t *head, *last;
+
+	head = last = parse_and_or(ps);
+	while (!ps->status && (ps->tok == T_SEMI || ps->tok == T_NL))
+	{
+		lex_next(ps, 0);
+		parse_linebreak(ps);
+		if (list_end(ps))
+			break;
+		last->next = parse_and_or(ps);
+		last = last->next;
+	}
+	return (head);
+}
+
+/**
+ * parse_and_or - Parses commands joined by "&&" and "||".
+ * @ps: The parser state.
+ *
+ * Return: The command, grouped from the left.
+ */
+node_t *parse_and_or(parse_t *ps)
+{
+	node_t *n = parse_command(ps);
+
+	while (!ps->status && (ps->tok == T_AND || ps->tok == T_OR))
+	{
+		n = node_new(ps, ps->tok == T_AND ? N_AND : N_OR, n);
+		lex_next(ps, 0);
+		parse_linebreak(ps);
+		if (n)
+			n->b = parse_command(ps);
+	}
+	return (n);
+}
+
+/**
+ * parse_command - Parses a command, which may be negated with '!', or a
+ *                 function definition.
+ * @ps: The parser state.
+ *
+ * Return: The command, or NULL after recording an error.
+ */
+node_t *parse_command(parse_t *ps)
+{
+	node_t *n;
+	int toks;
+
+	if (ps->status)
+		return (NULL);
+	if (lex_is(ps, "!"))
+	{
+		lex_next(ps, 0);
+		n = node_new(ps, N_NOT, NULL);
+		if (n)
+			n->a = parse_command(ps);
+		return (n);
+	}
+	if (lex_is(ps, "if"))
+		return (parse_if(ps));
+	if (lex_is(ps, "while"))
+		return (parse_loop(ps, N_WHILE));
+	if (lex_is(ps, "until"))
+		return (parse_loop(ps, N_UNTIL));
+	if (lex_is(ps, "for"))
+		return (parse_for(ps));
+	if (lex_is(ps, "case"))
+		return (parse_case(ps));
+	if (lex_is(ps, "{"))
+		return (parse_group(ps));
+	toks = parse_is_func(ps);
+	if (toks)
+		return (parse_func(ps, toks));
+	if (ps->tok != T_WORD || list_end(ps))
+	{
+		parse_error(ps);
+		return (NULL);
+	}
+	return (parse_simple(ps));
+}
+
+/**
+ * parse_simple - Parses a simple command: a command name and arguments,
+ *                or variable assignments, and its here-document.
+ * @ps: The parser state.
+ *
+ * Return: The command.
+ */
+node_t *parse_simple(parse_t *ps)
+{
+	node_t *n = node_new(ps, N_CMD, NULL);
+	int count = 0;
+
+	while (n && !ps->status && ps->tok == T_WORD)
+	{
+		if (_strncmp(ps->start, "<<", 2) == 0)
+			parse_heredoc(ps, n);
+		else
+			count = words_add(ps, &n->words, count);
+		lex_next(ps, 0);
+	}
+	return (n);
+}
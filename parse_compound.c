@@ -0,0 +1,182 @@
+#include "shell.h"
+
+node_t *parse_if(parse_t *ps);
+node_t *parse_loop(parse_t *ps, int type);
+node_t *parse_for(parse_t *ps);
+node_t *parse_case(parse_t *ps);
+node_t *parse_item(parse_t *ps);
+
+/**
+ * parse_if - Parses an if command, or the elif part of one.
+ * @ps: The parser state. The current token is "if" or "elif".
+ *
+ * Return: The command. An elif part becomes a nested if command, which
+ *         reads the "fi" shared with the outer one.
+ */
+node_t *parse_if(parse_t *ps)
+{
+	node_t *n = node_new(ps, N_IF, NULL);
+
+	lex_next(ps, 0);
+	if (!n)
+		return (NULL);
+	n->a = parse_body(ps, "then");
+	n->b = parse_body(ps, NULL);
+	if (ps->status)
+		return (n);
+	if (lex_is(ps, "elif"))
+		n->c = parse_if(ps);
+	else if (lex_is(ps, "else"))
+	{
+		lex_next(ps, 0);
+		n->c = parse_body(ps, "fi");
+	}
+	else
+		parse_expect(ps, "fi");
+	return (n);
+}
+
+/**
+ * parse_loop - Parses a while or until loop.
+ * @ps: The parser state. The current token is "while" or "until".
+ * @type: N_WHILE or N_UNTIL.
+ *
+ * Return: The command.
+ */
+node_t *parse_loop(parse_t *ps, int type)
+{
+	node_t *n = node_new(ps, type, NULL);
+
+	lex_next(ps, 0);
+	if (!n)
+		return (NULL);
+	n->a = parse_body(ps, "do");
+	n->b = parse_body(ps, "done");
+	return (n);
+}
+
+/**
+ * parse_for - Parses a for loop.
+ * @ps: The parser state. The current token is "for".
+ *
+ * Return: The command.
+ */
+node_t *parse_for(parse_t *ps)
+{
+	node_t *n = node_new(ps, N_FOR, NULL);
+	int count = 0;
+
+	lex_next(ps, 0);
+	if (!n)
+		return (NULL);
+	if (ps->tok != T_WORD || name_len(ps->start) != ps->len)
+	{
+		parse_error(ps);
+		return (n);
+	}
+	n->name = tok_dup(ps);
+	ps->status = n->name ? ps->status : PARSE_ERR;
+	lex_next(ps, 0);
+	parse_linebreak(ps);
+	if (lex_is(ps, "in"))
+	{
+		n->words = malloc(sizeof(char *) * 2);
+		if (n->words)
+			n->words[0] = n->words[1] = NULL;
+		else
+			ps->status = PARSE_ERR;
+		for (lex_next(ps, 0); !ps->status && ps->tok == T_WORD;)
+		{
+			count = words_add(ps, &n->words, count);
+			lex_next(ps, 0);
+		}
+		if (ps->tok != T_SEMI && ps->tok != T_NL)
+			parse_error(ps);
+	}
+	if (ps->tok == T_SEMI || ps->tok == T_NL)
+		lex_next(ps, 0);
+	parse_linebreak(ps);
+	if (parse_expect(ps, "do"))
+		n->b = parse_body(ps, "done");
+	return (n);
+}
+
+/**
+ * parse_case - Parses a case command.
+ * @ps: The parser state. The current token is "case".
+ *
+ * Return: The command.
+ */
+node_t *parse_case(parse_t *ps)
+{
+	node_t *n = node_new(ps, N_CASE, NULL), **item;
+
+	lex_next(ps, 0);
+	if (!n)
+		return (NULL);
+	if (ps->tok != T_WORD)
+	{
+		parse_error(ps);
+		return (n);
+	}
+	n->name = tok_dup(ps);
+	ps->status = n->name ? ps->status : PARSE_ERR;
+	lex_next(ps, 0);
+	parse_linebreak(ps);
+	if (!parse_expect(ps, "in"))
+		return (n);
+	parse_linebreak(ps);
+	for (item = &n->c; !ps->status && !lex_is(ps, "esac");)
+	{
+		*item = parse_item(ps);
+		if (*item)
+			item = &(*item)->next;
+	}
+	parse_expect(ps, "esac");
+	return (n);
+}
+
+/**
+ * parse_item - Parses one item of a case command: its patterns and the
+ *              commands run when one of them matches.
+ * @ps: The parser state. The current token starts the item.
+ *
+ * Return: The item.
+ */
+node_t *parse_item(parse_t *ps)
+{
+	node_t *n = node_new(ps, N_ITEM, NULL);
+	int count = 0;
+
+	if (!n)
+		return (NULL);
+	ps->p = ps->start;
+	lex_next(ps, 1);
+	if (ps->tok == T_LPAREN)
+		lex_next(ps, 1);
+	while (!ps->status && ps->tok == T_WORD)
+	{
+		count = words_add(ps, &n->words, count);
+		lex_next(ps, 1);
+		if (ps->tok != T_PIPE)
+			break;
+		lex_next(ps, 1);
+	}
+	if (!count || ps->tok != T_RPAREN)
+	{
+		parse_error(ps);
+		return (n);
+	}
+	lex_next(ps, 0);
+	parse_linebreak(ps);
+	if (ps->tok != T_DSEMI && !lex_is(ps, "esac"))
+		n->b = parse_list(ps);
+	if (ps->tok == T_DSEMI)
+	{
+		lex_next(ps, 0);
+		parse_linebreak(ps);
+	}
+	else if (!lex_is(ps, "esac"))
+		parse_error(ps);
+	return (n);
+}
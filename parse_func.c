@@ -0,0 +1,77 @@
+#include "shell.h"
+
+node_t *parse_group(parse_t *ps);
+int parse_is_func(parse_t *ps);
+node_t *parse_func(parse_t *ps, int toks);
+
+/**
+ * parse_group - Parses a "{ list; }" group of commands.
+ * @ps: The parser state, at the "{".
+ *
+ * Return: The group.
+ */
+node_t *parse_group(parse_t *ps)
+{
+	lex_next(ps, 0);
+	return (node_new(ps, N_GROUP, parse_body(ps, "}")));
+}
+
+/**
+ * parse_is_func - Checks if a function definition starts at the current
+ *                 token.
+ * @ps: The parser state. It is left as it is.
+ *
+ * Return: 1 if the token is written "name()".
+ *         2 if it is a name and the next token is "()".
+ *         0 if no function is defined here.
+ */
+int parse_is_func(parse_t *ps)
+{
+	parse_t peek = *ps;
+	int len;
+
+	if (ps->tok != T_WORD)
+		return (0);
+	len = name_len(ps->start);
+	if (!len)
+		return (0);
+	if (ps->len == len + 2 && _strncmp(ps->start + len, "()", 2) == 0)
+		return (1);
+	if (ps->len != len)
+		return (0);
+	peek.npending = 0;
+	lex_next(&peek, 0);
+	return (lex_is(&peek, "()") ? 2 : 0);
+}
+
+/**
+ * parse_func - Parses a function definition.
+ * @ps: The parser state, at the function name.
+ * @toks: The number of tokens the name and "()" take, from parse_is_func.
+ *
+ * Return: The definition. Its body is parsed once here and shared with
+ *         the function table when the definition runs.
+ */
+node_t *parse_func(parse_t *ps, int toks)
+{
+	node_t *n = node_new(ps, N_FUNC, NULL);
+	int len = name_len(ps->start);
+
+	if (!n)
+		return (NULL);
+	n->name = malloc(len + 1);
+	if (!n->name)
+	{
+		ps->status = PARSE_ERR;
+		return (n);
+	}
+	n->name[0] = '\0';
+	_strncat(n->name, ps->start, len);
+	while (toks--)
+		lex_next(ps, 0);
+	parse_linebreak(ps);
+	n->a = parse_command(ps);
+	if (n->a)
+		n->a->refs = 1;
+	return (n);
+}
@@ -0,0 +1,157 @@
+#include "shell.h"
+
+void lex_next(parse_t *ps, int pattern);
+char *lex_word(parse_t *ps, char *p, int pattern);
+int lex_is(parse_t *ps, char *word);
+int list_end(parse_t *ps);
+void parse_error(parse_t *ps);
+
+/**
+ * lex_next - Reads the next token of a command line.
+ * @ps: The parser state. Its token fields are updated.
+ * @pattern: Non-zero while reading case patterns, where '(', ')' and '|'
+ *           are operators. Elsewhere they are part of words.
+ *
+ * Description: Blanks are skipped and a '#' starting a word comments out
+ *              the rest of the line. After a newline, the bodies of the
+ *              here-documents started on that line are read.
+ */
+void lex_next(parse_t *ps, int pattern)
+{
+	static char *ops[] = { "\n", ";;", ";", "&&", "||", "(", ")", "|",
+		NULL };
+	static int toks[] = { T_NL, T_DSEMI, T_SEMI, T_AND, T_OR, T_LPAREN,
+		T_RPAREN, T_PIPE };
+	char *p = ps->p;
+	int i;
+
+	while (*p == ' ' || *p == '\t')
+		p++;
+	if (*p == '#')
+		while (*p && *p != '\n')
+			p++;
+	ps->start = p;
+	ps->tok = *p ? T_WORD : T_END;
+	for (i = 0; *p && ops[i] && (pattern || i < 5); i++)
+	{
+		if (_strncmp(p, ops[i], _strlen(ops[i])) == 0)
+		{
+			ps->tok = toks[i];
+			p += _strlen(ops[i]);
+			break;
+		}
+	}
+	if (ps->tok == T_WORD)
+		p = lex_word(ps, p, pattern);
+	ps->len = p - ps->start;
+	ps->p = p;
+	if (ps->tok == T_NL && ps->npending)
+		heredoc_read(ps);
+}
+
+/**
+ * lex_word - Finds the end of a word.
+ * @ps: The parser state.
+ * @p: The start of the word.
+ * @pattern: Non-zero while reading case patterns.
+ *
+ * Return: A pointer just past the word.
+ *
+ * Description: A "$(" expansion runs to its matching ')' and may contain
+ *              blanks and operators. If it is not closed, the input is
+ *              incomplete.
+ */
+char *lex_word(parse_t *ps, char *p, int pattern)
+{
+	int depth;
+
+	while (*p && *p != ' ' && *p != '\t' && *p != '\n' && *p != ';' &&
+	       _strncmp(p, "&&", 2) != 0 && _strncmp(p, "||", 2) != 0 &&
+	       !(pattern && _strchr("()|", *p)))
+	{
+		if (p[0] == '$' && p[1] == '(')
+		{
+			for (depth = 0, p++; *p; p++)
+			{
+				depth += (*p == '(') - (*p == ')');
+				if (!depth)
+					break;
+			}
+			if (!*p && !ps->status)
+				ps->status = PARSE_MORE;
+			if (!*p)
+				return (p);
+		}
+		p++;
+	}
+	return (p);
+}
+
+/**
+ * lex_is - Checks if the current token is a given word.
+ * @ps: The parser state.
+ * @word: The word, usually a reserved word such as "then".
+ *
+ * Return: Non-zero if the token is the word.
+ */
+int lex_is(parse_t *ps, char *word)
+{
+	return (ps->tok == T_WORD && ps->len == _strlen(word) &&
+		_strncmp(ps->start, word, ps->len) == 0);
+}
+
+/**
+ * list_end - Checks if the current token ends a list of commands.
+ * @ps: The parser state.
+ *
+ * Return: Non-zero at the end of the input, at ";;" or at a reserved word
+ *         that closes or continues a compound command, or at the "}"
+ *         closing a group.
+ */
+int list_end(parse_t *ps)
+{
+	static char *words[] = { "then", "else", "elif", "fi", "do", "done",
+		"esac", "}", NULL };
+	int i;
+
+	if (ps->tok == T_END || ps->tok == T_DSEMI)
+		return (1);
+	for (i = 0; words[i]; i++)
+	{
+		if (lex_is(ps, words[i]))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * parse_error - Records that the current token was not expected.
+ * @ps: The parser state.
+ *
+ * Description: At the end of the input the command is only incomplete and
+ *              nothing is printed, so that more input can be read.
+ *              Otherwise a syntax error naming the token is printed. Only
+ *              the first error is recorded.
+ */
+void parse_error(parse_t *ps)
+{
+	char c;
+
+	if (ps->status)
+		return;
+	if (ps->tok == T_END)
+	{
+		ps->status = PARSE_MORE;
+		return;
+	}
+	ps->status = PARSE_ERR;
+	if (ps->tok == T_NL)
+	{
+		print_error(ERR_SYNTAX, "newline");
+		return;
+	}
+	c = ps->start[ps->len];
+	ps->start[ps->len] = '\0';
+	print_error(ERR_SYNTAX, ps->start);
+	ps->start[ps->len] = c;
+}
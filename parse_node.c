@@ -0,0 +1,56 @@
+#include "shell.h"
+
+node_t *node_new(parse_t *ps, int type, node_t *a);
+void tree_free(node_t *n);
+
+/**
+ * node_new - Allocates a node of a parsed command.
+ * @ps: The parser state, marked as failed if memory runs out.
+ * @type: The kind of node (N_*).
+ * @a: The first child of the node, or NULL. It is freed if the node cannot
+ *     be allocated, so that no part of the tree is lost.
+ *
+ * Return: The node, or NULL if memory ran out.
+ */
+node_t *node_new(parse_t *ps, int type, node_t *a)
+{
+	node_t *n = malloc(sizeof(node_t));
+
+	if (!n)
+	{
+		tree_free(a);
+		ps->status = PARSE_ERR;
+		return (NULL);
+	}
+	_memset(n, 0, sizeof(node_t));
+	n->type = type;
+	n->a = a;
+	return (n);
+}
+
+/**
+ * tree_free - Frees a list of parsed commands and everything under them.
+ * @n: The first command of the list, or NULL.
+ *
+ * Description: A function body is only freed once nothing else holds it.
+ */
+void tree_free(node_t *n)
+{
+	node_t *next;
+
+	while (n)
+	{
+		next = n->next;
+		if (n->type == N_FUNC)
+			func_unref(n->a);
+		else
+			tree_free(n->a);
+		tree_free(n->b);
+		tree_free(n->c);
+		if (n->words)
+			free_args(n->words, n->words);
+		free(n->name);
+		free(n);
+		n = next;
+	}
+}
@@ -0,0 +1,105 @@
+#include "shell.h"
+
+void parse_linebreak(parse_t *ps);
+int parse_expect(parse_t *ps, char *word);
+node_t *parse_body(parse_t *ps, char *word);
+int words_add(parse_t *ps, char ***words, int n);
+char *tok_dup(parse_t *ps);
+
+/**
+ * parse_linebreak - Skips newlines.
+ * @ps: The parser state.
+ */
+void parse_linebreak(parse_t *ps)
+{
+	while (ps->tok == T_NL)
+		lex_next(ps, 0);
+}
+
+/**
+ * parse_expect - Reads a reserved word that must come next.
+ * @ps: The parser state.
+ * @word: The reserved word.
+ *
+ * Return: 1 if the word was read, or 0 after recording an error.
+ */
+int parse_expect(parse_t *ps, char *word)
+{
+	if (ps->status)
+		return (0);
+	if (!lex_is(ps, word))
+	{
+		parse_error(ps);
+		return (0);
+	}
+	lex_next(ps, 0);
+	return (1);
+}
+
+/**
+ * parse_body - Parses the list of commands inside a compound command.
+ * @ps: The parser state.
+ * @word: The reserved word that must follow the list, or NULL.
+ *
+ * Return: The first command of the list.
+ */
+node_t *parse_body(parse_t *ps, char *word)
+{
+	node_t *n;
+
+	parse_linebreak(ps);
+	n = parse_list(ps);
+	if (word)
+		parse_expect(ps, word);
+	return (n);
+}
+
+/**
+ * words_add - Appends the current token to an array of words.
+ * @ps: The parser state.
+ * @words: A pointer to the array, which may be NULL.
+ * @n: The number of words in the array.
+ *
+ * Return: The new number of words.
+ *
+ * Description: The array is kept terminated by two NULL entries, the way
+ *              free_args expects.
+ */
+int words_add(parse_t *ps, char ***words, int n)
+{
+	char **new;
+
+	new = _realloc(*words, sizeof(char *) * (*words ? n + 2 : 0),
+		       sizeof(char *) * (n + 3));
+	if (!new)
+	{
+		ps->status = PARSE_ERR;
+		return (n);
+	}
+	*words = new;
+	new[n + 1] = new[n + 2] = NULL;
+	new[n] = tok_dup(ps);
+	if (!new[n])
+	{
+		ps->status = PARSE_ERR;
+		return (n);
+	}
+	return (n + 1);
+}
+
+/**
+ * tok_dup - Copies the text of the current token.
+ * @ps: The parser state.
+ *
+ * Return: The copy, or NULL if memory ran out.
+ */
+char *tok_dup(parse_t *ps)
+{
+	char *s = malloc(ps->len + 1);
+
+	if (!s)
+		return (NULL);
+	s[0] = '\0';
+	_strncat(s, ps->start, ps->len);
+	return (s);
+}
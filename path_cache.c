@@ -0,0 +1,187 @@
+#include "shell.h"
+
+path_cache_t *path_cache(void);
+list_t *path_cache_sync(char *path);
+void path_cache_check(char *command);
+path_ent_t *path_cache_find(char *command, char *path, int add);
+void path_cache_free(void);
+
+static path_cache_t pcache = { 0, NULL, NULL, 0, 0, -1, -1, -1, { { 0 } } };
+
+/**
+ * path_cache - Gets the command lookup cache.
+ *
+ * Return: A pointer to the cache.
+ */
+path_cache_t *path_cache(void)
+{
+	return (&pcache);
+}
+
+/**
+ * path_cache_sync - Rebuilds the cached PATH directories when PATH or PWD
+ *                   has changed, or when HSH_PATH_WATCH was toggled.
+ * @path: The value of PATH.
+ *
+ * Return: If an error occurs - NULL.
+ *         Otherwise - the list of PATH directories.
+ */
+list_t *path_cache_sync(char *path)
+{
+	list_t *node;
+	struct stat st;
+	size_t n = 0;
+	char **watch = _getenv("HSH_PATH_WATCH");
+	int want = (watch && (*watch)[14] == '=' && (*watch)[15]);
+
+	if (pcache.pd && pcache.gen == path_gen && want == (pcache.fd >= 0))
+		return (pcache.dirs);
+	path_cache_free();
+	pcache.dirs = get_path_dir(path);
+	for (node = pcache.dirs; node; node = node->next)
+		n++;
+	pcache.pd = malloc(sizeof(path_dir_t) * (n + 1));
+	if (!pcache.pd)
+	{
+		path_cache_free();
+		return (NULL);
+	}
+	_memset(pcache.pd, 0, sizeof(path_dir_t) * (n + 1));
+	for (n = 0, node = pcache.dirs; node; node = node->next, n++)
+	{
+		pcache.pd[n].dir = node->dir;
+		pcache.pd[n].fd = pcache.pd[n].wd = -1;
+	}
+	pcache.ndirs = n;
+	pcache.gen = path_gen;
+	pcache.stamp++;
+	if (want)
+		path_watch_open(&pcache);
+	for (n = 0, node = pcache.dirs; node; node = node->next, n++)
+	{
+		if (pcache.pd[n].wd >= 0)
+			continue;
+		if (stat(node->dir, &st) == -1)
+			_memset(&st, 0, sizeof(st));
+		path_dir_open(&pcache.pd[n], node->dir, &st);
+		pcache.pd[n].mtime = st.st_mtim;
+	}
+	return (pcache.dirs);
+}
+
+/**
+ * path_cache_check - Invalidates the cache when a PATH directory has been
+ *                    modified.
+ * @command: The command about to be looked up.
+ *
+ * Description: Creating, removing or renaming an entry updates the mtime
+ *              of its directory, so one stat per directory replaces the
+ *              lookup of the command in every directory. Directory stats
+ *              are also answered from the attribute cache on NFS, where
+ *              lookups of missing names are not. The stats are only made
+ *              when the cache holds an entry for the command to validate;
+ *              otherwise the search probes the directories anyway. A
+ *              directory that was replaced or created since is reopened.
+ *              Directories covered by the inotify watcher are not stat'ed
+ *              at all.
+ */
+void path_cache_check(char *command)
+{
+	struct stat st;
+	list_t *node;
+	path_dir_t *pd = pcache.pd;
+
+	path_watch_drain();
+	if (!path_cache_find(command, NULL, 0))
+		return;
+	for (node = pcache.dirs; node; node = node->next, pd++)
+	{
+		if (pd->wd >= 0)
+			continue;
+		if (stat(node->dir, &st) == -1)
+			_memset(&st, 0, sizeof(st));
+		if (st.st_ino != pd->ino || st.st_dev != pd->dev)
+			path_dir_open(pd, node->dir, &st);
+		if (st.st_mtim.tv_sec != pd->mtime.tv_sec ||
+		    st.st_mtim.tv_nsec != pd->mtime.tv_nsec)
+		{
+			pd->mtime = st.st_mtim;
+			pcache.stamp++;
+		}
+	}
+}
+
+/**
+ * path_cache_find - Looks up or records the location of a command.
+ * @command: The command name.
+ * @path: The full pathname of the command, or NULL if it is missing.
+ * @add: Non-zero to record path for command.
+ *
+ * Return: If command is not cached or cannot be recorded - NULL.
+ *         Otherwise - its entry. A NULL path means it is missing.
+ *
+ * Description: The table is direct-mapped; a new entry replaces whatever
+ *              occupied its slot. Entries recorded before the last change
+ *              of a PATH directory no longer match.
+ */
+path_ent_t *path_cache_find(char *command, char *path, int add)
+{
+	path_ent_t *slot;
+
+	slot = &pcache.ents[path_hash(command) & (PATH_CACHE_SLOTS - 1)];
+	if (!add)
+		return ((slot->name && slot->stamp == pcache.stamp &&
+			 _strcmp(slot->name, command) == 0) ? slot : NULL);
+	if (slot->path && slot->fd >= 0)
+		close(slot->fd);
+	free(slot->name);
+	free(slot->path);
+	slot->fd = -1;
+	slot->path = NULL;
+	slot->name = malloc(_strlen(command) + 1);
+	if (path)
+		slot->path = malloc(_strlen(path) + 1);
+	if (!slot->name || (path && !slot->path))
+	{
+		free(slot->name);
+		slot->name = NULL;
+		return (NULL);
+	}
+	_strcpy(slot->name, command);
+	if (path)
+		_strcpy(slot->path, path);
+	slot->stamp = pcache.stamp;
+	return (slot);
+}
+
+/**
+ * path_cache_free - Frees the cached PATH directories and entries, closes
+ *                   their descriptors and stops watching the directories.
+ */
+void path_cache_free(void)
+{
+	size_t i;
+
+	path_pool_wait();
+	for (i = 0; pcache.pd && i < pcache.ndirs; i++)
+		if (pcache.pd[i].fd >= 0)
+			close(pcache.pd[i].fd);
+	free_list(pcache.dirs);
+	free(pcache.pd);
+	pcache.dirs = NULL;
+	pcache.pd = NULL;
+	pcache.ndirs = 0;
+	if (pcache.fd >= 0)
+		close(pcache.fd);
+	pcache.fd = -1;
+	for (i = 0; i < PATH_CACHE_SLOTS; i++)
+	{
+		if (pcache.ents[i].path && pcache.ents[i].fd >= 0)
+			close(pcache.ents[i].fd);
+		free(pcache.ents[i].name);
+		free(pcache.ents[i].path);
+		pcache.ents[i].name = NULL;
+		pcache.ents[i].path = NULL;
+		pcache.ents[i].fd = -1;
+	}
+}
@@ -0,0 +1,152 @@
+#include "shell.h"
+
+void path_dir_open(path_dir_t *pd, char *dir, struct stat *st);
+char *path_join(char *dir, char *command);
+int path_probe(path_dir_t *pd, char *command);
+char *path_search(list_t *dirs, char *command);
+void path_execve(char *path, char **args, int resolved);
+
+/**
+ * path_dir_open - Opens a PATH directory for lookups relative to it.
+ * @pd: The cached directory. Its previous descriptor, if any, is closed.
+ * @dir: The directory name.
+ * @st: The current status of dir, zeroed if it does not exist.
+ *
+ * Description: An O_PATH descriptor only pins the directory, so lookups
+ *              and execs relative to it skip walking its path again. A
+ *              missing directory gets no descriptor.
+ */
+void path_dir_open(path_dir_t *pd, char *dir, struct stat *st)
+{
+	if (pd->fd >= 0)
+		close(pd->fd);
+	pd->fd = -1;
+	if (st->st_ino)
+		pd->fd = open(dir, O_PATH | O_DIRECTORY | O_CLOEXEC);
+	pd->dev = st->st_dev;
+	pd->ino = st->st_ino;
+}
+
+/**
+ * path_join - Builds the full pathname of a command in a directory.
+ * @dir: The directory.
+ * @command: The command name.
+ *
+ * Return: If an error occurs - NULL.
+ *         Otherwise - the malloc'd pathname.
+ */
+char *path_join(char *dir, char *command)
+{
+	char *path = malloc(_strlen(dir) + _strlen(command) + 2);
+
+	if (!path)
+		return (NULL);
+	_strcpy(path, dir);
+	_strcat(path, "/");
+	return (_strcat(path, command));
+}
+
+/**
+ * path_probe - Checks whether a PATH directory has a command.
+ * @pd: The directory.
+ * @command: The command name.
+ *
+ * Return: 1 if the directory has the command, otherwise 0.
+ *
+ * Description: The directory is probed with fstatat(2) on its cached
+ *              descriptor. Watched directories hold no descriptor, which
+ *              would delay the inotify event for their removal, and are
+ *              probed by full path instead. Safe to call from the probing
+ *              threads.
+ */
+int path_probe(path_dir_t *pd, char *command)
+{
+	struct stat st;
+	char *path;
+	int ret;
+
+	if (pd->fd >= 0)
+		return (fstatat(pd->fd, command, &st, 0) == 0);
+	if (pd->wd < 0)
+		return (0);
+	path = path_join(pd->dir, command);
+	if (!path)
+		return (0);
+	ret = (stat(path, &st) == 0);
+	free(path);
+	return (ret);
+}
+
+/**
+ * path_search - Searches the PATH directories for a command.
+ * @dirs: The PATH directories.
+ * @command: The command name.
+ *
+ * Return: If the command is not found or an error occurs - NULL.
+ *         Otherwise - the malloc'd full pathname of the command.
+ *
+ * Description: The directories are probed in order, or all at once when
+ *              HSH_PARALLEL_PATH enables the probing threads. The
+ *              directory found is remembered for path_execve. While the
+ *              directories are watched, the command is cached along with
+ *              an O_PATH descriptor to it.
+ */
+char *path_search(list_t *dirs, char *command)
+{
+	path_cache_t *pc = path_cache();
+	path_ent_t *ent;
+	char *path;
+	int i;
+
+	i = path_pool_find(command, pc->pd, pc->ndirs);
+	if (i == -2)
+		for (i = 0; dirs && !path_probe(&pc->pd[i], command); i++)
+			dirs = dirs->next;
+	if (i < 0 || (size_t)i >= pc->ndirs)
+	{
+		path_cache_find(command, NULL, 1);
+		return (NULL);
+	}
+	path = path_join(pc->pd[i].dir, command);
+	if (!path)
+		return (NULL);
+	pc->exec_dir = pc->pd[i].fd;
+	if (pc->fd < 0)
+		return (path);
+	ent = path_cache_find(command, path, 1);
+	if (ent)
+		ent->fd = open(path, O_PATH | O_CLOEXEC);
+	if (ent)
+		pc->exec_fd = ent->fd;
+	return (path);
+}
+
+/**
+ * path_execve - Executes a command, using the descriptors cached by the
+ *               lookup when possible.
+ * @path: The full pathname of the command.
+ * @args: The arguments of the command.
+ * @resolved: Non-zero if path was found by get_location.
+ *
+ * Description: A cached O_PATH descriptor of the binary is executed with
+ *              execveat(2) and AT_EMPTY_PATH; otherwise the name is
+ *              executed relative to its directory descriptor. Either way
+ *              the kernel does not walk the full path again. Scripts fail
+ *              there with ENOENT, because the interpreter cannot open the
+ *              close-on-exec descriptor, and fall back to execve(2).
+ *              A here-document given to the command becomes its standard
+ *              input.
+ */
+void path_execve(char *path, char **args, int resolved)
+{
+	path_cache_t *pc = path_cache();
+
+	if (cmd_stdin > 0)
+		dup2(cmd_stdin, STDIN_FILENO);
+	if (resolved && pc->exec_fd >= 0)
+		syscall(SYS_execveat, pc->exec_fd, "", args, environ,
+			AT_EMPTY_PATH);
+	else if (resolved && pc->exec_dir >= 0)
+		syscall(SYS_execveat, pc->exec_dir, args[0], args, environ, 0);
+	execve(path, args, environ);
+}
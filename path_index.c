@@ -0,0 +1,133 @@
+#include "shell.h"
+
+void path_index_free(void);
+void path_index_sync(void);
+int path_index_step(void);
+int complete_commands(char *word, int len, match_t *m);
+
+static path_index_t pidx;
+
+/**
+ * path_index_free - Releases the index of PATH executables.
+ */
+void path_index_free(void)
+{
+	if (pidx.dp)
+		closedir(pidx.dp);
+	free_list(pidx.dirs);
+	free(pidx.path);
+	free(pidx.names);
+	_memset(&pidx, 0, sizeof(pidx));
+}
+
+/**
+ * path_index_sync - Restarts the PATH index when PATH has changed.
+ *
+ * Description: Only the directory list is prepared here. The directories
+ *              are read later, a batch at a time, by path_index_step.
+ */
+void path_index_sync(void)
+{
+	char **path = _getenv("PATH");
+
+	if (!path)
+	{
+		path_index_free();
+		return;
+	}
+	if (pidx.path && _strcmp(pidx.path, *path + 5) == 0)
+		return;
+	path_index_free();
+	pidx.path = malloc(_strlen(*path + 5) + 1);
+	if (!pidx.path)
+		return;
+	_strcpy(pidx.path, *path + 5);
+	pidx.dirs = get_path_dir(pidx.path);
+	pidx.cur = pidx.dirs;
+}
+
+/**
+ * path_index_step - Adds one batch of directory entries to the index.
+ *
+ * Return: If the index is complete - 0.
+ *         Otherwise - 1.
+ *
+ * Description: Only the entries the user may execute are kept, so
+ *              completion never offers a file that would not run.
+ */
+int path_index_step(void)
+{
+	struct dirent *ent;
+	size_t n, len, cap;
+
+	if (!pidx.dp)
+	{
+		if (!pidx.cur)
+			return (0);
+		pidx.dp = opendir(pidx.cur->dir);
+		pidx.cur = pidx.cur->next;
+		return (1);
+	}
+	for (n = 0; n < PATH_INDEX_BATCH; n++)
+	{
+		ent = readdir(pidx.dp);
+		if (!ent)
+		{
+			closedir(pidx.dp);
+			pidx.dp = NULL;
+			break;
+		}
+		len = _strlen(ent->d_name) + 1;
+		if (ent->d_name[0] == '.' || ent->d_type == DT_DIR ||
+		    faccessat(dirfd(pidx.dp), ent->d_name, X_OK, 0) == -1)
+			continue;
+		if (pidx.used + len > pidx.cap)
+		{
+			cap = pidx.cap * 2 + 4096;
+			pidx.names = _realloc(pidx.names, pidx.cap, cap);
+			if (!pidx.names)
+			{
+				pidx.cap = pidx.used = 0;
+				pidx.cur = NULL;
+				return (1);
+			}
+			pidx.cap = cap;
+		}
+		_memcpy(pidx.names + pidx.used, ent->d_name, len);
+		pidx.used += len;
+	}
+	return (1);
+}
+
+/**
+ * complete_commands - Collects the command names that complete a word.
+ * @word: The word being completed.
+ * @len: The length of word.
+ * @m: The match list to fill.
+ *
+ * Return: 0.
+ *
+ * Description: Builtins and aliases come first, then whatever part of
+ *              the PATH index has been built so far.
+ */
+int complete_commands(char *word, int len, match_t *m)
+{
+	alias_t *alias;
+	size_t at;
+	int i;
+	char *cmd;
+
+	for (i = 0; (cmd = builtin_name(i)) != NULL; i++)
+		if (_strncmp(cmd, word, len) == 0)
+			match_add(m, cmd, _strlen(cmd), '\0');
+	for (alias = aliases; alias; alias = alias->next)
+		if (_strncmp(alias->name, word, len) == 0)
+			match_add(m, alias->name, _strlen(alias->name), '\0');
+	for (at = 0; at < pidx.used; at += _strlen(cmd) + 1)
+	{
+		cmd = pidx.names + at;
+		if (_strncmp(cmd, word, len) == 0)
+			match_add(m, cmd, _strlen(cmd), '\0');
+	}
+	return (0);
+}
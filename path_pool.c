@@ -0,0 +1,192 @@
+#include "shell.h"
+
+void *path_worker(void *arg);
+int path_pool_size(int want);
+void path_pool_wait(void);
+int path_pool_run(void);
+int path_pool_find(char *command, path_dir_t *pd, size_t ndirs);
+
+static path_pool_t pool = { NULL, 0, 0, PTHREAD_MUTEX_INITIALIZER,
+	PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+	NULL, NULL, NULL, 0, 0, 0, 0 };
+
+/**
+ * path_worker - Probes PATH directories for the current lookup until the
+ *               pool is stopped.
+ * @arg: Unused.
+ *
+ * Return: NULL.
+ */
+void *path_worker(void *arg)
+{
+	size_t i;
+	int found;
+
+	(void)arg;
+	pthread_mutex_lock(&pool.lock);
+	while (!pool.quit)
+	{
+		if (pool.next >= pool.ndirs)
+		{
+			pthread_cond_wait(&pool.work, &pool.lock);
+			continue;
+		}
+		i = pool.next++;
+		pool.busy++;
+		pthread_mutex_unlock(&pool.lock);
+		found = path_probe(&pool.pd[i], pool.command);
+		pthread_mutex_lock(&pool.lock);
+		pool.found[i] = found;
+		pool.busy--;
+		pthread_cond_broadcast(&pool.done);
+	}
+	pthread_mutex_unlock(&pool.lock);
+	return (NULL);
+}
+
+/**
+ * path_pool_size - Starts or stops worker threads to match the requested
+ *                  number of concurrent probes.
+ * @want: The number of concurrent probes, including the shell's own
+ *        thread. Less than 2 stops the pool.
+ *
+ * Return: The number of running workers.
+ *
+ * Description: A forked child inherits none of the workers, so it starts
+ *              over without touching the pool's lock.
+ */
+int path_pool_size(int want)
+{
+	int i;
+
+	want = want > PATH_POOL_MAX ? PATH_POOL_MAX : want;
+	if (pool.pid != getpid())
+		pool.nthreads = 0;
+	else if (want - 1 == pool.nthreads || (want < 2 && !pool.nthreads))
+		return (pool.nthreads);
+	if (pool.nthreads)
+	{
+		path_pool_wait();
+		pthread_mutex_lock(&pool.lock);
+		pool.quit = 1;
+		pthread_cond_broadcast(&pool.work);
+		pthread_mutex_unlock(&pool.lock);
+		for (i = 0; i < pool.nthreads; i++)
+			pthread_join(pool.threads[i], NULL);
+	}
+	free(pool.threads);
+	pool.threads = NULL;
+	pool.nthreads = pool.quit = 0;
+	pool.pid = getpid();
+	if (want < 2)
+	{
+		free(pool.command);
+		free(pool.found);
+		pool.command = NULL;
+		pool.found = NULL;
+		return (0);
+	}
+	pool.threads = malloc(sizeof(pthread_t) * (want - 1));
+	for (i = 0; pool.threads && i < want - 1; i++)
+		if (pthread_create(&pool.threads[i], NULL, path_worker, NULL))
+			break;
+	pool.nthreads = i;
+	return (i);
+}
+
+/**
+ * path_pool_wait - Waits for probes still running for an earlier lookup.
+ *
+ * Description: A lookup returns as soon as its earliest match is known,
+ *              while later directories may still be probed. Those probes
+ *              use the cached directories, so they must finish before the
+ *              next lookup or before the directories are freed. A forked
+ *              child has no workers and never waits.
+ */
+void path_pool_wait(void)
+{
+	if (!pool.nthreads || pool.pid != getpid())
+		return;
+	pthread_mutex_lock(&pool.lock);
+	pool.next = pool.ndirs;
+	while (pool.busy)
+		pthread_cond_wait(&pool.done, &pool.lock);
+	pthread_mutex_unlock(&pool.lock);
+}
+
+/**
+ * path_pool_run - Probes the directories of the current lookup along with
+ *                 the workers until its result is known.
+ *
+ * Return: If no directory has the command - -1.
+ *         Otherwise - the index of the earliest directory that has it.
+ */
+int path_pool_run(void)
+{
+	size_t i = 0, claim;
+	int found;
+
+	pthread_mutex_lock(&pool.lock);
+	pool.next = 0;
+	pthread_cond_broadcast(&pool.work);
+	while (i < pool.ndirs && pool.found[i] <= 0)
+	{
+		if (pool.found[i] == 0)
+			i++;
+		else if (pool.next >= pool.ndirs)
+			pthread_cond_wait(&pool.done, &pool.lock);
+		else
+		{
+			claim = pool.next++;
+			pthread_mutex_unlock(&pool.lock);
+			found = path_probe(&pool.pd[claim], pool.command);
+			pthread_mutex_lock(&pool.lock);
+			pool.found[claim] = found;
+		}
+	}
+	pool.next = pool.ndirs;
+	pthread_mutex_unlock(&pool.lock);
+	return (i < pool.ndirs ? (int)i : -1);
+}
+
+/**
+ * path_pool_find - Probes all PATH directories for a command at once.
+ * @command: The command name.
+ * @pd: The PATH directories.
+ * @ndirs: The number of directories.
+ *
+ * Return: If HSH_PARALLEL_PATH does not enable the pool - -2.
+ *         If no directory has the command - -1.
+ *         Otherwise - the index of the first directory in PATH order that
+ *         has it.
+ *
+ * Description: HSH_PARALLEL_PATH gives the number of concurrent probes.
+ *              The shell's thread claims directories along with the
+ *              workers, so a cold lookup costs about one round trip to
+ *              the slowest directory needed to decide it.
+ */
+int path_pool_find(char *command, path_dir_t *pd, size_t ndirs)
+{
+	char **var = _getenv("HSH_PARALLEL_PATH");
+	char *s = (var && (*var)[17] == '=') ? *var + 18 : "";
+	int want = 0;
+
+	for (; *s >= '0' && *s <= '9' && want < PATH_POOL_MAX; s++)
+		want = want * 10 + (*s - '0');
+	if (ndirs < 2 || path_pool_size(want) == 0)
+		return (-2);
+	path_pool_wait();
+	pthread_mutex_lock(&pool.lock);
+	free(pool.command);
+	free(pool.found);
+	pool.command = malloc(_strlen(command) + 1);
+	pool.found = malloc(ndirs);
+	pool.pd = pd;
+	pool.ndirs = pool.next = (pool.command && pool.found) ? ndirs : 0;
+	pthread_mutex_unlock(&pool.lock);
+	if (!pool.ndirs)
+		return (-2);
+	_strcpy(pool.command, command);
+	_memset(pool.found, -1, ndirs);
+	return (path_pool_run());
+}
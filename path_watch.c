@@ -0,0 +1,107 @@
+#include "shell.h"
+
+unsigned long path_hash(char *s);
+void path_watch_open(path_cache_t *pc);
+void path_watch_event(path_cache_t *pc, struct inotify_event *ev);
+void path_watch_drain(void);
+int path_watch_fd(void);
+
+/**
+ * path_hash - Hashes a command name (FNV-1a).
+ * @s: The command name.
+ *
+ * Return: The hash.
+ */
+unsigned long path_hash(char *s)
+{
+	unsigned long h = 14695981039346656037UL;
+
+	while (*s)
+		h = (h ^ (unsigned char)*s++) * 1099511628211UL;
+	return (h);
+}
+
+/**
+ * path_watch_open - Starts watching the PATH directories with inotify.
+ * @pc: The command lookup cache, with its directories just rebuilt.
+ *
+ * Description: A directory that cannot be watched, such as one that does
+ *              not exist yet, keeps being checked through its mtime.
+ */
+void path_watch_open(path_cache_t *pc)
+{
+	list_t *node;
+	size_t i = 0;
+
+	pc->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (pc->fd == -1)
+		return;
+	for (node = pc->dirs; node; node = node->next, i++)
+		pc->pd[i].wd = inotify_add_watch(pc->fd, node->dir,
+					       PATH_WATCH_EVENTS);
+}
+
+/**
+ * path_watch_event - Invalidates the cache entries affected by an event.
+ * @pc: The command lookup cache.
+ * @ev: The event.
+ *
+ * Description: An event on a name drops only the entry for that name: a
+ *              created file may shadow a later PATH directory, and a
+ *              removed one may uncover it. A lost event queue, or a
+ *              directory that was removed or renamed, drops everything
+ *              and rebuilds the watches on the next lookup.
+ */
+void path_watch_event(path_cache_t *pc, struct inotify_event *ev)
+{
+	path_ent_t *slot;
+
+	if (ev->mask & (IN_Q_OVERFLOW | IN_IGNORED | IN_DELETE_SELF |
+			IN_MOVE_SELF))
+	{
+		pc->gen = path_gen - 1;
+		pc->stamp++;
+		return;
+	}
+	if (!ev->len)
+		return;
+	slot = &pc->ents[path_hash(ev->name) & (PATH_CACHE_SLOTS - 1)];
+	if (slot->name && _strcmp(slot->name, ev->name) == 0)
+		slot->stamp = 0;
+}
+
+/**
+ * path_watch_drain - Applies every pending inotify event to the cache.
+ *
+ * Description: Called before each lookup and whenever the interactive
+ *              loop sees the inotify descriptor become readable.
+ */
+void path_watch_drain(void)
+{
+	path_cache_t *pc = path_cache();
+	char buf[4096] __attribute__((aligned(8)));
+	struct inotify_event *ev;
+	ssize_t len, off;
+
+	while (pc->fd >= 0)
+	{
+		len = read(pc->fd, buf, sizeof(buf));
+		if (len <= 0)
+			return;
+		for (off = 0; off < len; off += sizeof(*ev) + ev->len)
+		{
+			ev = (struct inotify_event *)(buf + off);
+			path_watch_event(pc, ev);
+		}
+	}
+}
+
+/**
+ * path_watch_fd - Gets the inotify descriptor of the command lookup cache.
+ *
+ * Return: The descriptor, or -1 when the directories are not watched.
+ */
+int path_watch_fd(void)
+{
+	return (path_cache()->fd);
+}
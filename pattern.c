@@ -0,0 +1,88 @@
+#include "shell.h"
+
+int pattern_match(char *p, char *s);
+int pattern_class(char *p, char c);
+
+/**
+ * pattern_match - Matches a string against a shell pattern.
+ * @p: The pattern. '*' matches any string, '?' any character and
+ *     "[...]" any character of a class. A '\' makes the next character
+ *     match itself.
+ * @s: The string.
+ *
+ * Return: 1 if the whole string matches, or 0 if it does not.
+ *
+ * Description: On a mismatch, the last '*' is made to swallow one more
+ *              character and matching resumes after it. Earlier stars
+ *              never need to be revisited, which keeps this linear in
+ *              practice and free of recursion.
+ */
+int pattern_match(char *p, char *s)
+{
+	char *star = NULL, *back = NULL;
+	int n;
+
+	while (*s)
+	{
+		if (*p == '*')
+		{
+			star = ++p;
+			back = s;
+			continue;
+		}
+		if (*p == '?')
+			n = 1;
+		else if (*p == '[')
+			n = pattern_class(p, *s);
+		else if (*p == '\\' && p[1])
+			n = p[1] == *s ? 2 : 0;
+		else
+			n = *p && *p == *s;
+		if (n)
+		{
+			p += n;
+			s++;
+		}
+		else if (!star)
+			return (0);
+		else
+		{
+			p = star;
+			s = ++back;
+		}
+	}
+	while (*p == '*')
+		p++;
+	return (*p == '\0');
+}
+
+/**
+ * pattern_class - Matches a character against a "[...]" class.
+ * @p: The class, starting at '['. A leading '!' or '^' negates it, a ']'
+ *     right after the '[' or the negation is part of the class, and a-z
+ *     is a range.
+ * @c: The character.
+ *
+ * Return: If c matches - the length of the class, to skip it.
+ *         If it does not - 0.
+ *         A '[' without its ']' only matches a '[' and has length 1.
+ */
+int pattern_class(char *p, char c)
+{
+	int i, neg, found = 0;
+
+	neg = p[1] == '!' || p[1] == '^';
+	for (i = 1 + neg; p[i] && (p[i] != ']' || i == 1 + neg); i++)
+	{
+		if (p[i + 1] == '-' && p[i + 2] && p[i + 2] != ']')
+		{
+			found |= c >= p[i] && c <= p[i + 2];
+			i += 2;
+		}
+		else
+			found |= c == p[i];
+	}
+	if (!p[i])
+		return (c == '[');
+	return (found != neg ? i + 1 : 0);
+}
@@ -0,0 +1,145 @@
+#include "shell.h"
+
+int shellby_printf(char **args, char __attribute__((__unused__)) **front);
+int pf_format(char *fmt, char ***argp, int *stop);
+char *pf_spec(char *p, fmt_t *f, char ***argp, int *ret);
+char *pf_field(char *p, int *field, char ***argp, int *ret);
+int pf_conv(fmt_t *f, char ***argp, int *stop);
+
+/**
+ * shellby_printf - Writes its arguments to standard output under the
+ *                  control of a format.
+ * @args: An array of arguments. The first one is the format.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If no format is given - 2.
+ *         If an argument or directive is invalid - 1.
+ *         Otherwise - 0.
+ *
+ * Description: The format is reused for as long as it consumes arguments
+ *              and some are left. The output goes through the builtin
+ *              output buffer.
+ */
+int shellby_printf(char **args, char __attribute__((__unused__)) **front)
+{
+	char **arg, **before;
+	int ret = 0, stop = 0;
+
+	if (!args[0])
+	{
+		print_error(ERR_PRINTF_USE, "");
+		return (2);
+	}
+	arg = args + 1;
+	do {
+		before = arg;
+		ret |= pf_format(args[0], &arg, &stop);
+	} while (!stop && *arg && arg != before);
+	return (ret);
+}
+
+/**
+ * pf_format - Writes the format once.
+ * @fmt: The format.
+ * @argp: A pointer to the next unused argument. It is advanced past the
+ *        arguments the conversions use.
+ * @stop: Set to 1 when output must stop (\c or an invalid directive).
+ *
+ * Return: 1 if an argument or directive was invalid, otherwise 0.
+ */
+int pf_format(char *fmt, char ***argp, int *stop)
+{
+	char *lit, c;
+	int ret = 0, n;
+	fmt_t f;
+
+	while (*fmt && !*stop)
+	{
+		for (lit = fmt; *fmt && *fmt != '%' && *fmt != '\\'; fmt++)
+			;
+		out_write(lit, fmt - lit);
+		if (*fmt == '\\')
+		{
+			n = esc_char(fmt + 1, &c, 0);
+			if (n == -1)
+				*stop = 1;
+			else
+				out_write(&c, 1);
+			fmt += n + 1;
+		}
+		else if (*fmt == '%' && fmt[1] == '%')
+		{
+			out_write("%", 1);
+			fmt += 2;
+		}
+		else if (*fmt == '%')
+		{
+			fmt = pf_spec(fmt + 1, &f, argp, &ret);
+			ret |= pf_conv(&f, argp, stop);
+		}
+	}
+	return (ret);
+}
+
+/**
+ * pf_spec - Parses the flags, width and precision of a conversion.
+ * @p: The text just after the '%'.
+ * @f: The conversion to fill in.
+ * @argp: A pointer to the next unused argument, for '*' fields.
+ * @ret: Set to 1 if a '*' argument is not a number.
+ *
+ * Return: A pointer just past the conversion character.
+ */
+char *pf_spec(char *p, fmt_t *f, char ***argp, int *ret)
+{
+	_memset(f, 0, sizeof(*f));
+	for (; *p && _strchr("-+ #0", *p); p++)
+	{
+		f->minus |= *p == '-';
+		f->plus |= *p == '+';
+		f->space |= *p == ' ';
+		f->hash |= *p == '#';
+		f->zero |= *p == '0';
+	}
+	p = pf_field(p, &f->width, argp, ret);
+	if (f->width < 0)
+	{
+		f->minus = 1;
+		f->width = -f->width;
+	}
+	f->prec = -1;
+	if (*p == '.')
+	{
+		f->prec = 0;
+		p = pf_field(p + 1, &f->prec, argp, ret);
+		if (f->prec < 0)
+			f->prec = -1;
+	}
+	f->conv = *p;
+	return (*p ? p + 1 : p);
+}
+
+/**
+ * pf_field - Parses a field width or precision.
+ * @p: The text where the field starts.
+ * @field: Where to store the value.
+ * @argp: A pointer to the next unused argument, taken for a '*' field.
+ * @ret: Set to 1 if a '*' argument is not a number.
+ *
+ * Return: A pointer just past the field.
+ */
+char *pf_field(char *p, int *field, char ***argp, int *ret)
+{
+	long num;
+
+	if (*p == '*')
+	{
+		*ret |= pf_number(**argp, &num, 1);
+		*argp += **argp != NULL;
+		*field = num;
+		return (p + 1);
+	}
+	for (*field = 0; *p >= '0' && *p <= '9'; p++)
+		*field = *field * 10 + (*p - '0');
+	return (p);
+}
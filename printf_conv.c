@@ -0,0 +1,172 @@
+#include "shell.h"
+
+int pf_conv(fmt_t *f, char ***argp, int *stop);
+int pf_number(char *s, long *num, int sign);
+int pf_int(fmt_t *f, char *arg);
+void pf_pad(fmt_t *f, char *pre, int zeros, char *s, size_t len);
+void pf_fill(char c, int n);
+
+/**
+ * pf_conv - Writes one conversion of a printf format.
+ * @f: The parsed conversion.
+ * @argp: A pointer to the next unused argument. A missing argument is
+ *        taken as an empty string or zero.
+ * @stop: Set to 1 when output must stop (\c in %b or an invalid directive).
+ *
+ * Return: 1 if the argument or the directive is invalid, otherwise 0.
+ */
+int pf_conv(fmt_t *f, char ***argp, int *stop)
+{
+	char *arg = **argp, dir[2];
+	size_t len;
+
+	if (!f->conv || !_strchr("bcdiosuxX", f->conv))
+	{
+		dir[0] = f->conv;
+		dir[1] = '\0';
+		print_error(ERR_PRINTF_DIR, dir);
+		*stop = 1;
+		return (1);
+	}
+	*argp += arg != NULL;
+	if (_strchr("diouxX", f->conv))
+		return (pf_int(f, arg));
+	if (!arg)
+		arg = "";
+	if (f->conv == 'b')
+		len = esc_expand(arg, arg, 1, stop);
+	else
+		len = _strlen(arg);
+	if (f->conv == 'c')
+		len = len > 0;
+	else if (f->prec >= 0 && (size_t)f->prec < len)
+		len = f->prec;
+	f->zero = 0;
+	pf_pad(f, "", 0, arg, len);
+	return (0);
+}
+
+/**
+ * pf_number - Converts a printf argument to a number.
+ * @s: The argument. NULL is taken as zero.
+ * @num: Where to store the number.
+ * @sign: Non-zero if the conversion is signed.
+ *
+ * Return: 1 if s is not completely a number or is out of range,
+ *         otherwise 0.
+ *
+ * Description: Numbers may be decimal, octal with a leading 0 or hex with
+ *              a leading 0x. An argument starting with a quote stands for
+ *              the value of the character after it. A value out of range
+ *              is clamped, as strtol(3) and strtoul(3) do.
+ */
+int pf_number(char *s, long *num, int sign)
+{
+	char *end;
+
+	*num = 0;
+	if (!s || !*s)
+		return (0);
+	if (*s == '\'' || *s == '"')
+	{
+		*num = (unsigned char)s[1];
+		return (0);
+	}
+	errno = 0;
+	if (sign)
+		*num = strtol(s, &end, 0);
+	else
+		*num = (long)strtoul(s, &end, 0);
+	if (end == s)
+		print_error(ERR_PRINTF_NUM, s);
+	else if (*end)
+		print_error(ERR_PRINTF_CONV, s);
+	else if (errno == ERANGE)
+		print_error(ERR_PRINTF_RANGE, s);
+	else
+		return (0);
+	return (1);
+}
+
+/**
+ * pf_int - Writes an integer conversion (d, i, o, u, x or X).
+ * @f: The parsed conversion.
+ * @arg: The argument, or NULL if none is left.
+ *
+ * Return: 1 if the argument is not a number or is out of range,
+ *         otherwise 0.
+ */
+int pf_int(fmt_t *f, char *arg)
+{
+	char buf[32], *digits = "0123456789abcdef", *pre = "";
+	unsigned long u;
+	long v;
+	int ret, base = 16, n = 0, zeros;
+
+	ret = pf_number(arg, &v, f->conv == 'd' || f->conv == 'i');
+	u = v;
+	if (f->conv == 'd' || f->conv == 'i')
+	{
+		base = 10;
+		if (v < 0)
+			u = -(unsigned long)v;
+		pre = v < 0 ? "-" : f->plus ? "+" : f->space ? " " : "";
+	}
+	else if (f->conv == 'o' || f->conv == 'u')
+		base = f->conv == 'o' ? 8 : 10;
+	if (f->conv == 'X')
+		digits = "0123456789ABCDEF";
+	for (; u; u /= base)
+		buf[31 - n++] = digits[u % base];
+	zeros = f->prec > n ? f->prec - n : 0;
+	if ((f->prec < 0 && !n) || (f->conv == 'o' && f->hash && !zeros))
+		zeros = 1;
+	if (base == 16 && f->hash && v)
+		pre = f->conv == 'X' ? "0X" : "0x";
+	if (f->prec >= 0 || f->minus)
+		f->zero = 0;
+	pf_pad(f, pre, zeros, buf + 32 - n, n);
+	return (ret);
+}
+
+/**
+ * pf_pad - Writes a converted value padded to its field width.
+ * @f: The parsed conversion.
+ * @pre: The sign or base prefix.
+ * @zeros: The number of zeros required between prefix and value.
+ * @s: The value.
+ * @len: The length of the value.
+ */
+void pf_pad(fmt_t *f, char *pre, int zeros, char *s, size_t len)
+{
+	int pad = f->width - _strlen(pre) - zeros - (int)len;
+
+	if (pad < 0)
+		pad = 0;
+	if (f->zero)
+	{
+		zeros += pad;
+		pad = 0;
+	}
+	if (!f->minus)
+		pf_fill(' ', pad);
+	out_puts(pre);
+	pf_fill('0', zeros);
+	out_write(s, len);
+	if (f->minus)
+		pf_fill(' ', pad);
+}
+
+/**
+ * pf_fill - Writes a run of one character.
+ * @c: The character.
+ * @n: The number of times to write it.
+ */
+void pf_fill(char c, int n)
+{
+	char buf[64];
+
+	_memset(buf, c, sizeof(buf));
+	for (; n > 0; n -= 64)
+		out_write(buf, n < 64 ? n : 64);
+}
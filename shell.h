@@ -1,6 +1,8 @@
 #ifndef _SHELL_H_
 #define _SHELL_H_
 
+#define _GNU_SOURCE
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <signal.h>
@@ -8,11 +10,200 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <poll.h>
+#include <termios.h>
+#include <dirent.h>
+#include <sys/signalfd.h>
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#include <pthread.h>
+#include <linux/io_uring.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <sched.h>
 #include <unistd.h>
 #include <errno.h>
+#include <limits.h>
 
 #define END_OF_FILE -2
 #define EXIT -3
+#define RETURN_LAST -4
+
+/* Builtin output buffer */
+#define OUT_BUF_SIZE 4096
+#define OUT_IOV_MAX 8
+
+/* History ring file */
+#define HIST_MAGIC 0x747369685f687368UL
+#ifndef HIST_SLOTS
+#define HIST_SLOTS 16384
+#endif
+#define HIST_LINE 120
+#define HIST_INDEX_BITS 256
+#define HIST_INDEX_SHIFT 24
+
+/* Line editor */
+#define EDIT_MAX 4096
+#define EDIT_CONTINUE 0
+#define EDIT_ACCEPT 1
+#define EDIT_EOF 2
+#define PATH_INDEX_BATCH 64
+
+/* Command lookup cache */
+#define PATH_CACHE_SLOTS 256
+#define PATH_POOL_MAX 64
+#define PATH_WATCH_EVENTS (IN_CREATE | IN_DELETE | IN_MOVED_FROM | \
+			   IN_MOVED_TO | IN_ATTRIB | IN_DELETE_SELF | \
+			   IN_MOVE_SELF | IN_ONLYDIR)
+
+/* io_uring backend */
+#define URING_ENTRIES 64
+#define URING_BATCH 32
+#define URING_BLOCK 65536
+#define URING_ID_AHEAD 62
+#define URING_ID_WRITE 63
+#define URING_IDS 64
+
+/* test builtin stat cache */
+#define STAT_CACHE_SLOTS 8
+#define STAT_PATH_MAX 256
+
+/* Arithmetic expansion bytecode */
+#define ARITH_SLOTS 64
+#define ARITH_STACK 128
+#define ARITH_DEPTH 64
+#define AR_NUM 0
+#define AR_VAR 1
+#define AR_STORE 2
+#define AR_JZ 3
+#define AR_JNZ 4
+#define AR_JMP 5
+#define AR_POP 6
+#define AR_DUP 7
+#define AR_BOOL 8
+#define AR_NEG 9
+#define AR_NOT 10
+#define AR_BNOT 11
+#define AR_MUL 12
+#define AR_DIV 13
+#define AR_MOD 14
+#define AR_ADD 15
+#define AR_SUB 16
+#define AR_SHL 17
+#define AR_SHR 18
+#define AR_LT 19
+#define AR_LE 20
+#define AR_GT 21
+#define AR_GE 22
+#define AR_EQ 23
+#define AR_NE 24
+#define AR_AND 25
+#define AR_XOR 26
+#define AR_OR 27
+#define AR_TOK_END 0
+#define AR_TOK_NUM 1
+#define AR_TOK_NAME 2
+#define AR_TOK_OP 3
+
+/* Command parser */
+#define PARSE_OK 0
+#define PARSE_MORE 1
+#define PARSE_ERR 2
+#define T_END 0
+#define T_WORD 1
+#define T_NL 2
+#define T_DSEMI 3
+#define T_SEMI 4
+#define T_AND 5
+#define T_OR 6
+#define T_LPAREN 7
+#define T_RPAREN 8
+#define T_PIPE 9
+#define N_CMD 0
+#define N_AND 1
+#define N_OR 2
+#define N_NOT 3
+#define N_IF 4
+#define N_WHILE 5
+#define N_UNTIL 6
+#define N_FOR 7
+#define N_CASE 8
+#define N_ITEM 9
+#define N_GROUP 10
+#define N_FUNC 11
+
+/* Here-documents */
+#define HEREDOC_MAX 8
+#define HEREDOC_PIPE 4096
+#define HD_STRIP 1
+#define HD_LITERAL 2
+#define HD_STRING 4
+
+/* Argument vectors */
+#define ARG_STRLEN_MAX 131072
+#define ARG_SLACK 2048
+
+/* xargs */
+#define XARGS_READ 65536
+
+/* Pathname expansion */
+#define GLOB_PATH_MAX 4096
+#define GLOB_DENTS 32768
+
+/* Shell functions */
+#define FUNC_SLOTS 64
+
+/* Command substitution */
+#define CMDSUB_DEPTH 8
+#define CMDSUB_READ 4096
+
+/* Resource limits */
+#define CG_PERIOD 100000
+#define CG_PATH_MAX 512
+
+/* Signals received through the signalfd */
+#define SIG_GOT_INT 1
+#define SIG_GOT_CHLD 2
+#define SIG_GOT_WINCH 4
+
+/* Error message table indices */
+#define ERR_ENV 0
+#define ERR_ALIAS 1
+#define ERR_EXIT 2
+#define ERR_CD 3
+#define ERR_CD_OPT 4
+#define ERR_SYNTAX 5
+#define ERR_PERM 6
+#define ERR_NOT_FOUND 7
+#define ERR_OPEN 8
+#define ERR_OPT_ARG 9
+#define ERR_HIST_NUM 10
+#define ERR_LIMIT_ARG 11
+#define ERR_LIMIT_CMD 12
+#define ERR_PRINTF_USE 13
+#define ERR_PRINTF_DIR 14
+#define ERR_PRINTF_NUM 15
+#define ERR_PRINTF_CONV 16
+#define ERR_TEST_OP 17
+#define ERR_TEST_NUM 18
+#define ERR_TEST_ARG 19
+#define ERR_TEST_BRACKET 20
+#define ERR_TEST_PAREN 21
+#define ERR_ARITH 22
+#define ERR_ARITH_DIV 23
+#define ERR_ARITH_NUM 24
+#define ERR_BREAK_NUM 25
+#define ERR_CONT_NUM 26
+#define ERR_RETURN_NUM 27
+#define ERR_LOCAL 28
+#define ERR_LOCAL_NAME 29
+#define ERR_ARG_MAX 30
+#define ERR_XARGS 31
+#define ERR_PRINTF_RANGE 32
+#define ERR_ARITH_CLOSE 33
 
 /* Global environemnt */
 extern char **environ;
@@ -20,6 +211,28 @@ extern char **environ;
 char *name;
 /* Global history counter */
 int hist;
+/* Global flag set while running the last command of the input */
+int tail_exec;
+/* Global generation of PATH and PWD, advanced whenever either changes */
+unsigned long path_gen;
+/* Global number of loops being run */
+int loop_depth;
+/* Global number of loops a pending break or continue leaves */
+int loop_break;
+/* Global flag set while a continue is pending */
+int loop_cont;
+/* Global positional parameters $1, $2... */
+char **pos_args;
+/* Global number of positional parameters */
+int pos_count;
+/* Global number of functions being run */
+int func_depth;
+/* Global flag set while a return is pending */
+int func_return;
+/* Global return value of the last command substitution, or -1 */
+int cmdsub_status;
+/* Global here-document descriptor given to commands as input, or 0 */
+int cmd_stdin;
 
 /**
  * struct list_s - A new struct type defining a linked list.
@@ -56,27 +269,658 @@ typedef struct alias_s
 	struct alias_s *next;
 } alias_t;
 
+/**
+ * struct fmt_s - A new struct type defining a printf conversion.
+ * @minus: Non-zero to left-justify the field.
+ * @plus: Non-zero to always sign signed conversions.
+ * @space: Non-zero to put a space before non-negative signed conversions.
+ * @hash: Non-zero for the alternate form (leading 0 or 0x).
+ * @zero: Non-zero to pad the field with zeros.
+ * @width: The minimum field width.
+ * @prec: The precision, or -1 if none was given.
+ * @conv: The conversion character.
+ */
+typedef struct fmt_s
+{
+	int minus;
+	int plus;
+	int space;
+	int hash;
+	int zero;
+	int width;
+	int prec;
+	char conv;
+} fmt_t;
+
+/**
+ * struct test_s - A new struct type defining the state of a test builtin.
+ * @args: The operands and operators.
+ * @argc: The number of entries in args.
+ * @pos: The index of the next entry to parse.
+ * @err: Non-zero once an error has been reported.
+ */
+typedef struct test_s
+{
+	char **args;
+	int argc;
+	int pos;
+	int err;
+} test_t;
+
+/**
+ * struct stat_ent_s - A new struct type defining a stat cache entry.
+ * @path: The path that was looked up.
+ * @follow: Non-zero if symbolic links were followed.
+ * @err: The errno of the lookup, or 0 if it succeeded.
+ * @st: The result of the lookup.
+ */
+typedef struct stat_ent_s
+{
+	char path[STAT_PATH_MAX];
+	int follow;
+	int err;
+	struct stat st;
+} stat_ent_t;
+
+/**
+ * struct arith_s - A new struct type defining a compiled arithmetic
+ * expression.
+ * @text: The expression text, which is the cache key.
+ * @code: The bytecode: AR_* opcodes, those up to AR_JMP followed by an
+ *        operand.
+ * @len: The number of entries in code.
+ * @names: The variables the expression uses, indexed by AR_VAR and
+ *         AR_STORE operands.
+ * @nnames: The number of entries in names.
+ */
+typedef struct arith_s
+{
+	char *text;
+	long *code;
+	int len;
+	char **names;
+	int nnames;
+} arith_t;
+
+/**
+ * struct arith_ps_s - A new struct type defining the state of the
+ * arithmetic expression compiler.
+ * @p: The next character to read.
+ * @tok: The kind of the current token (AR_TOK_*).
+ * @op: The current operator token, from the operator table.
+ * @num: The value of the current number token.
+ * @name: The start of the current name token.
+ * @nlen: The length of the current name token.
+ * @depth: The current nesting depth.
+ * @cap: The number of entries allocated for the code.
+ * @err: Non-zero once the expression is known to be invalid.
+ * @a: The expression being compiled.
+ */
+typedef struct arith_ps_s
+{
+	char *p;
+	int tok;
+	char *op;
+	long num;
+	char *name;
+	int nlen;
+	int depth;
+	int cap;
+	int err;
+	arith_t *a;
+} arith_ps_t;
+
+/**
+ * struct node_s - A new struct type defining a node of a parsed command.
+ * @type: The kind of node (N_*).
+ * @words: N_CMD: the words of the command. N_FOR: the words to loop over,
+ *         or NULL if "in" was left out. N_ITEM: the patterns.
+ * @name: N_FOR: the loop variable. N_CASE: the word to match. N_FUNC:
+ *        the function name. N_CMD: the here-document or here-string fed
+ *        to the command's standard input, or NULL.
+ * @a: N_AND, N_OR and N_NOT: the first command. N_IF, N_WHILE and
+ *     N_UNTIL: the condition. N_GROUP: the commands. N_FUNC: the body.
+ * @b: N_AND and N_OR: the second command. Otherwise the body run by the
+ *     if, loop or case item.
+ * @c: N_IF: the elif or else part. N_CASE: the first case item.
+ * @next: The next command of a list, or the next case item.
+ * @refs: For the body of a function: the number of holders, among the
+ *        definition, the function table and the calls running it.
+ * @heredoc: N_CMD: the HD_* flags of the here-document.
+ *
+ * Description: Words are kept as they were written. They are expanded
+ *              each time their command runs, so a loop body is parsed
+ *              once however many times it runs.
+ */
+typedef struct node_s
+{
+	int type;
+	char **words;
+	char *name;
+	struct node_s *a;
+	struct node_s *b;
+	struct node_s *c;
+	struct node_s *next;
+	int refs;
+	int heredoc;
+} node_t;
+
+/**
+ * struct cmdsub_s - A new struct type defining the output captured by a
+ * command substitution.
+ * @buf: The output, with room for a terminating '\0'.
+ * @len: The number of bytes captured.
+ * @cap: The allocated size of buf.
+ * @fd: The pipe an external command writes to while it runs.
+ */
+typedef struct cmdsub_s
+{
+	char *buf;
+	size_t len;
+	size_t cap;
+	int fd[2];
+} cmdsub_t;
+
+/**
+ * struct glob_dir_s - A new struct type defining a directory listing read
+ * for pathname expansion.
+ * @path: The directory, as written in the pattern, or "" for the current
+ *        directory.
+ * @names: The entries, one after the other, each a d_type byte followed
+ *         by the '\0'-terminated name.
+ * @used: The number of bytes used in names.
+ * @cap: The allocated size of names.
+ * @next: The next directory read for the same command.
+ */
+typedef struct glob_dir_s
+{
+	char *path;
+	char *names;
+	size_t used;
+	size_t cap;
+	struct glob_dir_s *next;
+} glob_dir_t;
+
+/**
+ * struct argv_s - A new struct type defining a growing argument vector.
+ * @v: The words, terminated by two NULL entries the way free_args expects.
+ * @n: The number of words.
+ * @cap: The number of entries allocated for v.
+ */
+typedef struct argv_s
+{
+	char **v;
+	size_t n;
+	size_t cap;
+} argv_t;
+
+/**
+ * struct brace_seq_s - A new struct type defining a {FROM..TO..STEP}
+ *                      sequence.
+ * @from: The first value.
+ * @to: The last value.
+ * @step: The distance between values, always positive.
+ * @width: The width numbers are padded to with zeros, or 0.
+ * @alpha: Non-zero if the values are letters.
+ */
+typedef struct brace_seq_s
+{
+	long from;
+	long to;
+	long step;
+	int width;
+	int alpha;
+} brace_seq_t;
+
+/**
+ * struct xargs_s - A new struct type defining a run of the xargs builtin.
+ * @cmd: The command and its initial arguments.
+ * @ncmd: The number of words in cmd.
+ * @max: The most items given to one run of the command, or 0 for as many
+ *       as fit.
+ * @procs: The most runs of the command at the same time.
+ * @nul: Non-zero if items are separated by '\0' rather than blanks.
+ * @path: The pathname of the command.
+ * @resolved: Non-zero if path was found by get_location.
+ * @room: The bytes left for items once the command and environment are
+ *        passed.
+ * @mask: The signal mask runs of the command start with.
+ * @in: The input. Separators are replaced by '\0' in place.
+ * @count: The number of items in the input.
+ * @running: The number of runs not waited for yet.
+ * @status: The exit status of xargs so far.
+ */
+typedef struct xargs_s
+{
+	char **cmd;
+	int ncmd;
+	int max;
+	int procs;
+	int nul;
+	char *path;
+	int resolved;
+	size_t room;
+	sigset_t mask;
+	cmdsub_t in;
+	size_t count;
+	int running;
+	int status;
+} xargs_t;
+
+/**
+ * struct glob_ctx_s - A new struct type defining the state of the
+ * pathname expansion of a command's words.
+ * @out: The expanded words.
+ * @err: Non-zero once memory ran out.
+ * @dirs: The directories read so far, shared by all the words.
+ * @path: The path being built.
+ */
+typedef struct glob_ctx_s
+{
+	argv_t out;
+	int err;
+	glob_dir_t *dirs;
+	char path[GLOB_PATH_MAX];
+} glob_ctx_t;
+
+/**
+ * struct glob_key_s - A new struct type defining a string being sorted.
+ * @key: The first 8 bytes of the string, as a big-endian number.
+ * @s: The string.
+ *
+ * Description: Most comparisons are settled by the keys, which sit next
+ *              to each other in memory, without reading the strings.
+ */
+typedef struct glob_key_s
+{
+	unsigned long key;
+	char *s;
+} glob_key_t;
+
+/**
+ * struct func_s - A new struct type defining a shell function.
+ * @name: The function name.
+ * @body: The parsed body, shared with the definition that set it.
+ * @next: The next function in the same table slot.
+ */
+typedef struct func_s
+{
+	char *name;
+	node_t *body;
+	struct func_s *next;
+} func_t;
+
+/**
+ * struct local_s - A new struct type defining a variable made local to a
+ * function.
+ * @name: The variable name.
+ * @saved: The "NAME=VALUE" entry to restore, or NULL if the variable was
+ *         unset.
+ * @next: The variable made local before this one.
+ */
+typedef struct local_s
+{
+	char *name;
+	char *saved;
+	struct local_s *next;
+} local_t;
+
+/**
+ * struct parse_s - A new struct type defining the state of the command
+ * parser.
+ * @p: The next character to read.
+ * @tok: The kind of the current token (T_*).
+ * @start: The start of the current token.
+ * @len: The length of the current token.
+ * @status: PARSE_OK, PARSE_MORE once the input ended too early, or
+ *          PARSE_ERR once a syntax error was reported.
+ * @pending: The commands whose here-documents start after the next
+ *           newline. Their name holds the delimiter until then.
+ * @npending: The number of entries in pending.
+ */
+typedef struct parse_s
+{
+	char *p;
+	int tok;
+	char *start;
+	int len;
+	int status;
+	node_t *pending[HEREDOC_MAX];
+	int npending;
+} parse_t;
+
+/**
+ * struct err_msg_s - A new struct type defining an error message template.
+ * @head: Non-zero if the message is prefixed with "name: hist".
+ * @arg_len: The maximum number of argument bytes to print (0 for all).
+ * @pre: The text written before the offending argument.
+ * @post: The text written after the offending argument.
+ */
+typedef struct err_msg_s
+{
+	int head;
+	int arg_len;
+	char *pre;
+	char *post;
+} err_msg_t;
+
+/**
+ * struct hist_head_s - A new struct type defining the history file header.
+ * @magic: HIST_MAGIC once the file is initialized.
+ * @slots: The number of slots in the ring.
+ * @next: The sequence number the next entry will get.
+ * @indexed: One past the first sequence number covered by the search
+ *           index, or 0 if the file predates the index.
+ */
+typedef struct hist_head_s
+{
+	unsigned long magic;
+	unsigned long slots;
+	unsigned long next;
+	unsigned long indexed;
+} hist_head_t;
+
+/**
+ * struct hist_slot_s - A new struct type defining a history ring slot.
+ * @seq: The entry's sequence number plus one, or 0 while it is written.
+ * @line: The command line.
+ *
+ * Description: The file holds the header, then one bigram signature per
+ *              slot, then the slots, then the search index. The index has
+ *              HIST_INDEX_BITS bitmaps, one per hashed bigram, each with
+ *              a bit per slot. A search ANDs the bitmaps of the query's
+ *              bigrams a word at a time and only visits the slots left.
+ */
+typedef struct hist_slot_s
+{
+	unsigned long seq;
+	char line[HIST_LINE];
+} hist_slot_t;
+
+/**
+ * struct edit_s - A new struct type defining the line editor state.
+ * @buf: The line being edited.
+ * @len: The length of the line.
+ * @pos: The cursor position in the line.
+ * @saved: The typed line, kept while browsing history.
+ * @saved_len: The length of saved.
+ * @prompt: The prompt.
+ * @plen: The length of the prompt.
+ * @cols: The terminal width.
+ * @hist_seq: The history entry being shown, or the end of the history.
+ * @hist_first: The oldest history entry still in the ring.
+ * @searching: Non-zero during a ^R search.
+ * @query: The ^R search query.
+ * @qlen: The length of the query.
+ * @found: Non-zero if the query has a match.
+ * @match: The history entry matching the query.
+ * @mlen: The length of the match.
+ * @match_seq: The sequence number of the match.
+ * @sprompt: The ^R search prompt.
+ * @splen: The length of the search prompt.
+ */
+typedef struct edit_s
+{
+	char buf[EDIT_MAX];
+	int len;
+	int pos;
+	char saved[EDIT_MAX];
+	int saved_len;
+	char *prompt;
+	int plen;
+	int cols;
+	unsigned long hist_seq;
+	unsigned long hist_first;
+	int searching;
+	char query[HIST_LINE];
+	int qlen;
+	int found;
+	char match[HIST_LINE];
+	int mlen;
+	unsigned long match_seq;
+	char sprompt[HIST_LINE + 32];
+	int splen;
+} edit_t;
+
+/**
+ * struct match_s - A new struct type defining a list of completions.
+ * @v: The candidates.
+ * @len: The number of candidates.
+ * @cap: The allocated size of v.
+ */
+typedef struct match_s
+{
+	char **v;
+	int len;
+	int cap;
+} match_t;
+
+/**
+ * struct path_index_s - A new struct type defining the index of PATH
+ *                       executables used for completion.
+ * @path: The PATH value the index is built from.
+ * @dirs: The PATH directories.
+ * @cur: The next directory to read.
+ * @dp: The directory being read.
+ * @names: The indexed names, each terminated by '\0'.
+ * @used: The number of bytes used in names.
+ * @cap: The allocated size of names.
+ */
+typedef struct path_index_s
+{
+	char *path;
+	list_t *dirs;
+	list_t *cur;
+	DIR *dp;
+	char *names;
+	size_t used;
+	size_t cap;
+} path_index_t;
+
+/**
+ * struct timing_s - The measurement of one command.
+ * @start: The monotonic time the command started.
+ * @self: The shell's own usage at the start, then the usage reported.
+ * @real_us: The wall-clock time the command took, in microseconds.
+ * @print: Non-zero if the command was prefixed with "time".
+ * @log: The file named by HSH_RUSAGE_LOG, or NULL.
+ */
+typedef struct timing_s
+{
+	struct timespec start;
+	struct rusage self;
+	long real_us;
+	int print;
+	char *log;
+} timing_t;
+
+/**
+ * struct limit_s - The resource limits of one command.
+ * @mem: The memory limit in bytes, or 0.
+ * @cpu: The CPU time allowed per CG_PERIOD microseconds, or 0.
+ * @secs: The CPU time limit in seconds, or 0.
+ * @nofile: The open file limit, or 0.
+ * @active: Non-zero while a limited command runs.
+ * @cg: The cgroup v2 leaf of the command, or an empty string.
+ */
+typedef struct limit_s
+{
+	long mem;
+	long cpu;
+	long secs;
+	long nofile;
+	int active;
+	char cg[CG_PATH_MAX];
+} limit_t;
+
+/**
+ * struct path_ent_s - The cached location of a command.
+ * @name: The command name.
+ * @path: The full pathname of the command, or NULL if it is missing.
+ * @fd: An O_PATH descriptor of the command, or -1.
+ * @stamp: The cache stamp the entry was recorded under.
+ */
+typedef struct path_ent_s
+{
+	char *name;
+	char *path;
+	int fd;
+	unsigned long stamp;
+} path_ent_t;
+
+/**
+ * struct path_dir_s - A cached PATH directory.
+ * @dir: The directory name.
+ * @fd: An O_PATH descriptor of the directory, or -1 if it is missing.
+ * @wd: The inotify watch of the directory, or -1.
+ * @dev: The device of the directory when it was opened.
+ * @ino: The inode of the directory when it was opened.
+ * @mtime: The last seen modification time of the directory.
+ */
+typedef struct path_dir_s
+{
+	char *dir;
+	int fd;
+	int wd;
+	dev_t dev;
+	ino_t ino;
+	struct timespec mtime;
+} path_dir_t;
+
+/**
+ * struct path_cache_s - The PATH directories used for command lookup.
+ * @gen: The value of path_gen the directories were read for.
+ * @dirs: The PATH directories.
+ * @pd: The descriptors and status of each directory.
+ * @ndirs: The number of directories.
+ * @stamp: Advanced whenever the directories change.
+ * @fd: The inotify descriptor, or -1 when HSH_PATH_WATCH is unset.
+ * @exec_fd: The descriptor of the binary found by the last lookup, or -1.
+ * @exec_dir: The directory descriptor of the last lookup, or -1.
+ * @ents: The cached command locations.
+ */
+typedef struct path_cache_s
+{
+	unsigned long gen;
+	list_t *dirs;
+	path_dir_t *pd;
+	size_t ndirs;
+	unsigned long stamp;
+	int fd;
+	int exec_fd;
+	int exec_dir;
+	path_ent_t ents[PATH_CACHE_SLOTS];
+} path_cache_t;
+
+/**
+ * struct path_pool_s - The threads probing PATH directories in parallel.
+ * @threads: The worker threads.
+ * @nthreads: The number of worker threads.
+ * @pid: The process that started the workers.
+ * @lock: Protects the fields below it.
+ * @work: Signalled when a lookup starts or the pool stops.
+ * @done: Signalled when a probe completes.
+ * @command: The command being looked up.
+ * @found: Per directory: -1 while unknown, then 1 if it has the command.
+ * @pd: The directories being probed.
+ * @ndirs: The number of directories.
+ * @next: The next directory to claim.
+ * @busy: The number of probes in progress.
+ * @quit: Set to stop the workers.
+ */
+typedef struct path_pool_s
+{
+	pthread_t *threads;
+	int nthreads;
+	pid_t pid;
+	pthread_mutex_t lock;
+	pthread_cond_t work;
+	pthread_cond_t done;
+	char *command;
+	signed char *found;
+	path_dir_t *pd;
+	size_t ndirs;
+	size_t next;
+	size_t busy;
+	int quit;
+} path_pool_t;
+
+/**
+ * struct uring_s - An io_uring instance and its mapped rings.
+ * @fd: The io_uring descriptor, or -1.
+ * @pid: The process that set the ring up.
+ * @sq_head: The head of the submission queue, advanced by the kernel.
+ * @sq_tail: The tail of the submission queue.
+ * @sq_mask: The index mask of the submission queue.
+ * @sq_array: The submission queue entries' indices.
+ * @cq_head: The head of the completion queue.
+ * @cq_tail: The tail of the completion queue, advanced by the kernel.
+ * @cq_mask: The index mask of the completion queue.
+ * @sqes: The submission queue entries.
+ * @cqes: The completion queue entries.
+ * @sq_map: The mapping of the submission ring.
+ * @cq_map: The mapping of the completion ring.
+ * @sq_size: The size of sq_map.
+ * @cq_size: The size of cq_map.
+ * @sqe_size: The size of sqes.
+ * @entries: The number of submission queue entries.
+ * @queued: The number of entries queued but not yet submitted.
+ * @res: The result of each completed operation, by identifier.
+ * @done: Non-zero for each identifier whose operation has completed.
+ */
+typedef struct uring_s
+{
+	int fd;
+	pid_t pid;
+	unsigned int *sq_head;
+	unsigned int *sq_tail;
+	unsigned int sq_mask;
+	unsigned int *sq_array;
+	unsigned int *cq_head;
+	unsigned int *cq_tail;
+	unsigned int cq_mask;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	void *sq_map;
+	void *cq_map;
+	size_t sq_size;
+	size_t cq_size;
+	size_t sqe_size;
+	unsigned int entries;
+	unsigned int queued;
+	int res[URING_IDS];
+	char done[URING_IDS];
+} uring_t;
+
 /* Global aliases linked list */
 alias_t *aliases;
+/* Global mapping of the shared history file, or NULL */
+hist_head_t *hist_map;
+/* Global output capture of the running command substitution, or NULL */
+cmdsub_t *cmdsub_out;
 
 /* Main Helpers */
 ssize_t _getline(char **lineptr, size_t *n, FILE *stream);
+int input_at_eof(void);
 void *_realloc(void *ptr, unsigned int old_size, unsigned int new_size);
 char **_strtok(char *line, char *delim);
 char *get_location(char *command);
 list_t *get_path_dir(char *path);
 int execute(char **args, char **front);
+void free_shell(void);
 void free_list(list_t *head);
 char *_itoa(int num);
+int _itoa_buf(long num, char *buffer);
 
 /* Input Helpers */
-void handle_line(char **line, ssize_t read);
-void variable_replacement(char **args, int *exe_ret);
+char *get_pid(void);
+char *get_replacement(char *line, int j, int *k, int *exe_ret);
+int variable_replacement(char **args, int *exe_ret);
 char *get_args(char *line, int *exe_ret);
-int call_args(char **args, char **front, int *exe_ret);
+char *get_more(char *line);
 int run_args(char **args, char **front, int *exe_ret);
+int run_func(node_t *body, char **cmd, int *exe_ret, int limited);
 int handle_args(int *exe_ret);
-int check_args(char **args);
 void free_args(char **args, char **front);
 char **replace_aliases(char **args);
 
@@ -89,9 +933,21 @@ char *_strchr(char *s, char c);
 int _strspn(char *s, char *accept);
 int _strcmp(char *s1, char *s2);
 int _strncmp(const char *s1, const char *s2, size_t n);
+char *_strstr(char *haystack, char *needle);
+void *_memcpy(void *dest, const void *src, size_t n);
+void *_memset(void *s, int c, size_t n);
+int name_len(char *s);
+
+/* Builtin Output */
+void out_flush(void);
+void writev_all(int fd, struct iovec *iov, int cnt);
+void out_writev(struct iovec *iov, int cnt);
+void out_write(char *str, size_t len);
+void out_puts(char *str);
 
 /* Builtins */
 int (*get_builtin(char *command))(char **args, char **front);
+char *builtin_name(int index);
 int shellby_exit(char **args, char **front);
 int shellby_env(char **args, char __attribute__((__unused__)) **front);
 int shellby_setenv(char **args, char __attribute__((__unused__)) **front);
@@ -99,21 +955,305 @@ int shellby_unsetenv(char **args, char __attribute__((__unused__)) **front);
 int shellby_cd(char **args, char __attribute__((__unused__)) **front);
 int shellby_alias(char **args, char __attribute__((__unused__)) **front);
 int shellby_help(char **args, char __attribute__((__unused__)) **front);
+int shellby_history(char **args, char __attribute__((__unused__)) **front);
+int shellby_echo(char **args, char __attribute__((__unused__)) **front);
+int shellby_printf(char **args, char __attribute__((__unused__)) **front);
+int shellby_test(char **args, char __attribute__((__unused__)) **front);
+int shellby_bracket(char **args, char __attribute__((__unused__)) **front);
+int shellby_break(char **args, char __attribute__((__unused__)) **front);
+int shellby_continue(char **args, char __attribute__((__unused__)) **front);
+int shellby_return(char **args, char __attribute__((__unused__)) **front);
+int shellby_local(char **args, char __attribute__((__unused__)) **front);
+int shellby_xargs(char **args, char __attribute__((__unused__)) **front);
+
+/* xargs */
+int xargs_opts(xargs_t *x, char **args);
+size_t xargs_read(xargs_t *x);
+int xargs_batch(xargs_t *x, char **argv, size_t *pos);
+int xargs_find(xargs_t *x);
+void xargs_spawn(xargs_t *x, char **argv);
+void xargs_child(xargs_t *x, char **argv);
+void xargs_wait(xargs_t *x);
+
+/* Echo and Printf */
+int esc_char(char *s, char *c, int zero);
+size_t esc_expand(char *s, char *out, int zero, int *stop);
+int pf_format(char *fmt, char ***argp, int *stop);
+char *pf_spec(char *p, fmt_t *f, char ***argp, int *ret);
+char *pf_field(char *p, int *field, char ***argp, int *ret);
+int pf_conv(fmt_t *f, char ***argp, int *stop);
+int pf_number(char *s, long *num, int sign);
+int pf_int(fmt_t *f, char *arg);
+void pf_pad(fmt_t *f, char *pre, int zeros, char *s, size_t len);
+void pf_fill(char c, int n);
+
+/* Arithmetic Expansion */
+char *arith_expand(char *start, int *used, int *exe_ret);
+arith_t *arith_compile(char *text);
+void arith_free(arith_t *a);
+void arith_cache_free(void);
+void arith_next(arith_ps_t *ps);
+char *arith_num(char *s, long *num);
+int arith_binop(char *op, int len, int *prec);
+int arith_emit(arith_ps_t *ps, long op, long arg);
+void arith_var(arith_ps_t *ps);
+int arith_name(arith_ps_t *ps);
+void arith_comma(arith_ps_t *ps);
+void arith_assign(arith_ps_t *ps);
+void arith_cond(arith_ps_t *ps);
+void arith_binary(arith_ps_t *ps, int min);
+void arith_unary(arith_ps_t *ps);
+int arith_exec(arith_t *a, long *result);
+long arith_op(long op, long x, long y, int *err);
+int arith_get(char *var, long *num);
+int arith_set(char *var, long num);
+
+/* Command Parser */
+int parse_script(char *line, node_t **tree);
+node_t *parse_list(parse_t *ps);
+node_t *parse_and_or(parse_t *ps);
+node_t *parse_command(parse_t *ps);
+node_t *parse_simple(parse_t *ps);
+node_t *parse_if(parse_t *ps);
+node_t *parse_loop(parse_t *ps, int type);
+node_t *parse_for(parse_t *ps);
+node_t *parse_case(parse_t *ps);
+node_t *parse_item(parse_t *ps);
+node_t *parse_group(parse_t *ps);
+int parse_is_func(parse_t *ps);
+node_t *parse_func(parse_t *ps, int toks);
+void parse_heredoc(parse_t *ps, node_t *n);
+void heredoc_read(parse_t *ps);
+void heredoc_body(parse_t *ps, node_t *n);
+int heredoc_exec(node_t *n, int *exe_ret, int tail);
+int heredoc_fd(char *text, size_t len, int nl);
+void lex_next(parse_t *ps, int pattern);
+char *lex_word(parse_t *ps, char *p, int pattern);
+int lex_is(parse_t *ps, char *word);
+int list_end(parse_t *ps);
+void parse_error(parse_t *ps);
+void parse_linebreak(parse_t *ps);
+int parse_expect(parse_t *ps, char *word);
+node_t *parse_body(parse_t *ps, char *word);
+int words_add(parse_t *ps, char ***words, int n);
+node_t *node_new(parse_t *ps, int type, node_t *a);
+char *tok_dup(parse_t *ps);
+void tree_free(node_t *n);
+
+/* Command Execution */
+int run_tree(node_t *tree, int status, int *exe_ret, int tail);
+int exec_list(node_t *n, int *exe_ret, int tail);
+int exec_node(node_t *n, int *exe_ret, int tail);
+int exec_simple(char **words, int *exe_ret, int tail);
+int exec_if(node_t *n, int *exe_ret, int tail);
+int exec_assign(char **words, int *exe_ret);
+int exec_loop(node_t *n, int *exe_ret);
+int exec_for(node_t *n, int *exe_ret);
+int exec_case(node_t *n, int *exe_ret, int tail);
+int loop_leave(void);
+int loop_arg(char *arg, int err);
+char *expand_word(char *word, int *exe_ret);
+char **expand_words(char **words, int split, int *exe_ret);
+int expand_split(argv_t *av, char *s);
+int var_assign(char *word);
+int var_set(char *var, char *value);
+int pattern_match(char *p, char *s);
+int pattern_class(char *p, char c);
+
+/* Argument Vectors */
+int argv_push(argv_t *av, char *s);
+size_t argv_size(char **v);
+size_t argv_limit(void);
+int argv_fits(char **args);
+char **argv_dup(char **v);
+
+/* Brace Expansion */
+char **brace_words(char **words);
+int brace_word(argv_t *av, char *word);
+int brace_find(char *word, char **open, char **close);
+int brace_alts(argv_t *av, char *word, char *open, char *close);
+int brace_join(argv_t *av, char *word, char *open, char *alt, int len,
+	       char *close);
+int brace_seq(argv_t *av, char *word, char *open, char *close);
+int brace_range(char *s, char *end, brace_seq_t *r);
+int brace_num(char *s, long *n);
+int brace_item(char *buf, long v, brace_seq_t *r);
+char *brace_skip(char *p);
+
+/* Pathname Expansion */
+char **glob_words(char **args);
+void glob_walk(glob_ctx_t *g, int plen, char *rest);
+void glob_match_dir(glob_ctx_t *g, int plen, char *comp, char *rest);
+void glob_push(glob_ctx_t *g, char *s);
+int glob_magic(char *s);
+glob_dir_t *glob_dir(glob_ctx_t *g, int plen);
+int glob_read(glob_dir_t *dir, int fd);
+int glob_is_dir(char *path);
+void glob_free(glob_dir_t *dir);
+void glob_sort(char **v, size_t n);
+void glob_merge(glob_key_t *src, glob_key_t *dst, size_t lo, size_t mid,
+		size_t hi);
+unsigned long glob_key(char *s);
+
+/* Shell Functions */
+func_t **func_slot(char *fname);
+node_t *func_find(char *fname);
+int func_define(char *fname, node_t *body);
+void func_unref(node_t *body);
+void func_free_all(void);
+int func_call(node_t *body, char **args, int *exe_ret);
+int local_save(char *var, int len);
+void local_restore(local_t *mark);
+char *param_value(char c, int *exe_ret);
+char *param_join(void);
+
+/* Command Substitution */
+char *cmdsub_expand(char *start, int *used, int *exe_ret);
+void cmdsub_exec(node_t *tree, cmdsub_t *out, int *exe_ret);
+int cmdsub_safe(node_t *n, int depth);
+int cmdsub_cmd_safe(char **words, int depth);
+void cmdsub_add(cmdsub_t *out, char *buf, size_t len);
+void cmdsub_pipe(void);
+void cmdsub_child(void);
+void cmdsub_read(void);
+void cmdsub_fork(node_t *tree, int *exe_ret);
+
+/* Test */
+int test_run(char **args, int argc);
+int test_or(test_t *t);
+int test_and(test_t *t);
+int test_not(test_t *t);
+int test_primary(test_t *t);
+int test_binary(test_t *t, char *a, char *op, char *b);
+int test_num(test_t *t, char *s, long *num);
+int test_op(char *s, int binary);
+void stat_cache_reset(void);
+struct stat *stat_cached(char *path, int follow);
+int test_unary(test_t *t, char op, char *arg);
+int test_access(struct stat *st, int mode);
+int test_files(char *a, char *op, char *b);
 
 /* Builtin Helpers */
 char **_copyenv(void);
 void free_env(void);
 char **_getenv(const char *var);
+int env_set(char **env_var, char *value);
+int env_remove(char **env_var);
+
+/* History */
+int hist_open(void);
+void hist_close(void);
+void hist_add(char *line);
+int hist_get(unsigned long seq, char *buf, unsigned long sig);
+unsigned long hist_count(unsigned long *first);
+unsigned long hist_sig(char *str, int len);
+void print_hist_entry(unsigned long seq, char *line, int len);
+int hist_search(char **args);
+int hist_query(char *query, int *buckets);
+int hist_bucket(char *s);
+size_t hist_file_size(unsigned long slots);
+unsigned long *hist_index(unsigned long *words);
+void hist_index_add(unsigned long seq, char *line, int len);
+int hist_index_scan(char *query, int *buckets, int n,
+		unsigned long seq, unsigned long next);
+
+/* Signals */
+int sig_init(void);
+void sig_child(void);
+int sig_read(void);
+int sig_fd_get(void);
+int wait_child(pid_t pid);
+
+/* io_uring Backend */
+int uring_setup(uring_t *u);
+uring_t *uring_get(void);
+int uring_queue(uring_t *u, struct io_uring_sqe *op, int id);
+int uring_wait(uring_t *u, int id);
+void uring_close(void);
+ssize_t uring_writev(int fd, struct iovec *iov, int cnt);
+ssize_t uring_read_all(int fd, char *buf, size_t size);
+int uring_read_ahead(int fd, char *buf, size_t len, off_t off);
+ssize_t uring_read_done(void);
+int in_block(void);
+void in_sync(void);
+ssize_t in_fill(void);
+int in_append(char **line, size_t *used, size_t *size, char c);
+ssize_t in_getline(char **lineptr, size_t *n);
+
+/* Resource Accounting */
+int timing_start(char **args, timing_t *t);
+void timing_child(struct rusage *ru);
+void timing_end(timing_t *t, char **args, int status, int is_builtin);
+long tv_us(struct timeval *tv);
+size_t json_str(char *buf, size_t room, char **args);
+size_t json_num(char *buf, char *key, long num);
+void timing_report(timing_t *t, char **args, int status, int is_builtin);
+
+/* Resource Limits */
+int limit_num(char *s, long scale, int suffix, long *out);
+long *limit_field(char *opt, long *scale);
+char **limit_start(char **args);
+void limit_child(void);
+void limit_end(void);
+int cg_write(char *dir, char *file, long value);
+int cg_path(char *buf, size_t size);
+void cg_create(limit_t *l);
+void cpu_affinity(long cpus);
+
+/* Line Editor */
+char *_readline(char *prompt);
+int edit_raw(int on);
+int term_cols(void);
+char *edit_fallback(char *prompt);
+void edit_refresh(edit_t *e);
+int edit_getc(edit_t *e, char *c);
+void edit_insert(edit_t *e, char *str, int n);
+void edit_delete(edit_t *e, int at, int n);
+void edit_history(edit_t *e, int dir);
+int edit_escape(edit_t *e);
+int edit_key(edit_t *e, char c);
+void search_find(edit_t *e, unsigned long from);
+void search_prompt(edit_t *e);
+void search_end(edit_t *e, int keep);
+int search_key(edit_t *e, char c);
+
+/* Completion */
+void edit_complete(edit_t *e);
+int match_add(match_t *m, char *name, int len, char suffix);
+int match_cmp(const void *a, const void *b);
+void complete_list(edit_t *e, match_t *m);
+void complete_insert(edit_t *e, match_t *m, int blen);
+int complete_files(char *word, int len, int base, match_t *m);
+int complete_commands(char *word, int len, match_t *m);
+void path_index_free(void);
+void path_index_sync(void);
+int path_index_step(void);
+
+/* Command Lookup Cache */
+path_cache_t *path_cache(void);
+list_t *path_cache_sync(char *path);
+void path_cache_check(char *command);
+path_ent_t *path_cache_find(char *command, char *path, int add);
+void path_cache_free(void);
+unsigned long path_hash(char *s);
+void path_watch_open(path_cache_t *pc);
+void path_watch_event(path_cache_t *pc, struct inotify_event *ev);
+void path_watch_drain(void);
+int path_watch_fd(void);
+void path_dir_open(path_dir_t *pd, char *dir, struct stat *st);
+char *path_join(char *dir, char *command);
+int path_probe(path_dir_t *pd, char *command);
+char *path_search(list_t *dirs, char *command);
+void *path_worker(void *arg);
+int path_pool_size(int want);
+void path_pool_wait(void);
+int path_pool_run(void);
+int path_pool_find(char *command, path_dir_t *pd, size_t ndirs);
+void path_execve(char *path, char **args, int resolved);
 
 /* Error Handling */
 int create_error(char **args, int err);
-char *error_env(char **args);
-char *error_1(char **args);
-char *error_2_exit(char **args);
-char *error_2_cd(char **args);
-char *error_2_syntax(char **args);
-char *error_126(char **args);
-char *error_127(char **args);
+int print_error(int id, char *arg);
 
 /* Linkedlist Helpers */
 alias_t *add_alias_end(alias_t **head, char *name, char *value);
@@ -130,6 +1270,19 @@ void help_env(void);
 void help_setenv(void);
 void help_unsetenv(void);
 void help_history(void);
+void help_time(void);
+void help_limit(void);
+void help_echo(void);
+void help_printf(void);
+void help_test(void);
+void help_break(void);
+void help_continue(void);
+void help_return(void);
+void help_local(void);
+int help_more(char *cmd);
+void help_xargs(void);
 
 int proc_file_commands(char *file_path, int *exe_ret);
+int run_commands(char *line, int *exe_ret, int tail);
+int proc_string_commands(char **argv, int *exe_ret);
 #endif /* _SHELL_H_ */
@@ -0,0 +1,120 @@
+#include "shell.h"
+
+int sig_init(void);
+void sig_child(void);
+int sig_read(void);
+int sig_fd_get(void);
+int wait_child(pid_t pid);
+
+static int sig_fd = -1;
+static sigset_t sig_old;
+
+/**
+ * sig_init - Routes SIGINT, SIGCHLD and SIGWINCH to a signalfd.
+ *
+ * Return: If the signalfd cannot be created - -1.
+ *         Otherwise - the signalfd.
+ *
+ * Description: The signals are blocked, so they never interrupt the
+ *              shell asynchronously. The interactive loop polls the
+ *              signalfd next to the terminal and handles them in order.
+ */
+int sig_init(void)
+{
+	sigset_t mask;
+
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGINT);
+	sigaddset(&mask, SIGCHLD);
+	sigaddset(&mask, SIGWINCH);
+	if (sigprocmask(SIG_BLOCK, &mask, &sig_old) == -1)
+		return (-1);
+	sig_fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (sig_fd == -1)
+		sigprocmask(SIG_SETMASK, &sig_old, NULL);
+	return (sig_fd);
+}
+
+/**
+ * sig_child - Restores the inherited signal mask in a forked child.
+ */
+void sig_child(void)
+{
+	if (sig_fd == -1)
+		return;
+	close(sig_fd);
+	sig_fd = -1;
+	sigprocmask(SIG_SETMASK, &sig_old, NULL);
+}
+
+/**
+ * sig_read - Drains the signalfd.
+ *
+ * Return: A mask of SIG_GOT_* bits for the signals received.
+ *
+ * Description: SIGCHLD also reaps any child that is not waited for
+ *              elsewhere, so none is left as a zombie.
+ */
+int sig_read(void)
+{
+	struct signalfd_siginfo info;
+	int got = 0;
+
+	if (sig_fd == -1)
+		return (0);
+	while (read(sig_fd, &info, sizeof(info)) == sizeof(info))
+	{
+		if (info.ssi_signo == SIGINT)
+			got |= SIG_GOT_INT;
+		else if (info.ssi_signo == SIGWINCH)
+			got |= SIG_GOT_WINCH;
+		else if (info.ssi_signo == SIGCHLD)
+			got |= SIG_GOT_CHLD;
+	}
+	if (got & SIG_GOT_CHLD)
+		while (waitpid(-1, NULL, WNOHANG) > 0)
+			;
+	return (got);
+}
+
+/**
+ * sig_fd_get - Gets the signalfd.
+ *
+ * Return: The signalfd, or -1 outside interactive mode.
+ */
+int sig_fd_get(void)
+{
+	return (sig_fd);
+}
+
+/**
+ * wait_child - Waits for a foreground child to finish and records its
+ *              resource usage.
+ * @pid: The process ID of the child.
+ *
+ * Return: The exit status of the child, or 128 plus the number of the
+ *         signal that killed it.
+ *
+ * Description: A ^C typed while the child ran reached the shell too and
+ *              is still queued on the signalfd; it is discarded here so
+ *              the next prompt does not see it again.
+ */
+int wait_child(pid_t pid)
+{
+	int status = 0;
+	struct rusage ru;
+
+	while (wait4(pid, &status, 0, &ru) == -1)
+		if (errno != EINTR)
+			return (1);
+	timing_child(&ru);
+	if (WIFSIGNALED(status))
+	{
+		if (WTERMSIG(status) == SIGINT && sig_fd != -1)
+			write(STDOUT_FILENO, "\n", 1);
+		sig_read();
+		return (128 + WTERMSIG(status));
+	}
+	sig_read();
+	return (WEXITSTATUS(status));
+}
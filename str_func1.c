@@ -4,6 +4,7 @@ char *_strchr(char *s, char c);
 int _strspn(char *s, char *accept);
 int _strcmp(char *s1, char *s2);
 int _strncmp(const char *s1, const char *s2, size_t n);
+char *_strstr(char *haystack, char *needle);
 
 /**
  * _strchr - Locates a character in a string.
@@ -103,3 +104,25 @@ int _strncmp(const char *s1, const char *s2, size_t n)
 	else
 		return (-15);
 }
+
+/**
+ * _strstr - Locates a substring.
+ * @haystack: The string to be searched.
+ * @needle: The substring to be located.
+ *
+ * Return: If needle is found - a pointer to its first occurence.
+ *         If needle is not found - NULL.
+ */
+char *_strstr(char *haystack, char *needle)
+{
+	int i;
+
+	for (; *haystack; haystack++)
+	{
+		for (i = 0; needle[i] && haystack[i] == needle[i]; i++)
+			;
+		if (!needle[i])
+			return (haystack);
+	}
+	return (*needle ? NULL : haystack);
+}
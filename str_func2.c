@@ -0,0 +1,40 @@
+#include "shell.h"
+
+void *_memset(void *s, int c, size_t n);
+int name_len(char *s);
+
+/**
+ * _memset - Fills memory with a constant byte.
+ * @s: Pointer to the memory area.
+ * @c: The byte to fill with.
+ * @n: The number of bytes to fill.
+ *
+ * Return: Pointer to s.
+ */
+void *_memset(void *s, int c, size_t n)
+{
+	char *p = s;
+
+	while (n--)
+		*p++ = c;
+	return (s);
+}
+
+/**
+ * name_len - Measures the variable name at the start of a string.
+ * @s: The string.
+ *
+ * Return: The length of the name, made of letters, digits and '_' and
+ *         not starting with a digit, or 0 if s does not start with one.
+ */
+int name_len(char *s)
+{
+	int i;
+
+	if (*s >= '0' && *s <= '9')
+		return (0);
+	for (i = 0; s[i] == '_' || (s[i] >= '0' && s[i] <= '9') ||
+	     ((s[i] | 32) >= 'a' && (s[i] | 32) <= 'z'); i++)
+		;
+	return (i);
+}
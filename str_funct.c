@@ -4,6 +4,7 @@ int _strlen(const char *s);
 char *_strcpy(char *dest, const char *src);
 char *_strcat(char *dest, const char *src);
 char *_strncat(char *dest, const char *src, size_t n);
+void *_memcpy(void *dest, const void *src, size_t n);
 
 /**
  * _strlen - Returns the length of a string.
@@ -84,3 +85,21 @@ char *_strncat(char *dest, const char *src, size_t n)
 
 	return (dest);
 }
+
+/**
+ * _memcpy - Copies n bytes from one memory area to another.
+ * @dest: Pointer to the destination area.
+ * @src: Pointer to the source area.
+ * @n: The number of bytes to copy.
+ *
+ * Return: Pointer to dest.
+ */
+void *_memcpy(void *dest, const void *src, size_t n)
+{
+	char *d = dest;
+	const char *s = src;
+
+	while (n--)
+		*d++ = *s++;
+	return (dest);
+}
@@ -0,0 +1,132 @@
+#include "shell.h"
+
+int shellby_test(char **args, char __attribute__((__unused__)) **front);
+int shellby_bracket(char **args, char __attribute__((__unused__)) **front);
+int test_run(char **args, int argc);
+int test_or(test_t *t);
+int test_and(test_t *t);
+
+/**
+ * shellby_test - Evaluates a conditional expression.
+ * @args: An array of arguments making up the expression.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If the expression is true - 0.
+ *         If it is false - 1.
+ *         If it is malformed - 2.
+ */
+int shellby_test(char **args, char __attribute__((__unused__)) **front)
+{
+	int argc;
+
+	for (argc = 0; args[argc]; argc++)
+		;
+	return (test_run(args, argc));
+}
+
+/**
+ * shellby_bracket - Evaluates a conditional expression closed by "]".
+ * @args: An array of arguments making up the expression.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If the expression is true - 0.
+ *         If it is false - 1.
+ *         If it is malformed or the "]" is missing - 2.
+ */
+int shellby_bracket(char **args, char __attribute__((__unused__)) **front)
+{
+	int argc;
+
+	for (argc = 0; args[argc]; argc++)
+		;
+	if (!argc || _strcmp(args[argc - 1], "]") != 0)
+	{
+		print_error(ERR_TEST_BRACKET, "");
+		return (2);
+	}
+	return (test_run(args, argc - 1));
+}
+
+/**
+ * test_run - Evaluates the expression of a test or [ builtin.
+ * @args: The operands and operators.
+ * @argc: The number of entries in args.
+ *
+ * Return: 0 if the expression is true, 1 if it is false or empty, or 2 if
+ *         it is malformed.
+ *
+ * Description: Up to four arguments follow the POSIX rules that depend
+ *              on the argument count, so "! a -o b" negates "a -o b".
+ *              Longer expressions are parsed by precedence.
+ */
+int test_run(char **args, int argc)
+{
+	test_t t;
+	int ret, bin = argc == 3 && test_op(args[1], 1);
+
+	if (!argc)
+		return (1);
+	if (argc <= 4 && argc >= 2 && !bin && _strcmp(args[0], "!") == 0)
+	{
+		ret = test_run(args + 1, argc - 1);
+		return (ret == 2 ? 2 : !ret);
+	}
+	if ((argc == 3 || argc == 4) && !bin && _strcmp(args[0], "(") == 0 &&
+	    _strcmp(args[argc - 1], ")") == 0)
+		return (test_run(args + 1, argc - 2));
+	if (argc == 2 && !test_op(args[0], 0))
+	{
+		print_error(ERR_TEST_OP, args[0]);
+		return (2);
+	}
+	t.args = args;
+	t.argc = argc;
+	t.pos = 0;
+	t.err = 0;
+	ret = test_or(&t);
+	if (!t.err && t.pos < t.argc)
+	{
+		print_error(ERR_TEST_OP, t.args[t.pos]);
+		t.err = 1;
+	}
+	return (t.err ? 2 : !ret);
+}
+
+/**
+ * test_or - Parses and evaluates expressions joined by "-o".
+ * @t: The parser state.
+ *
+ * Return: The truth value of the expression.
+ */
+int test_or(test_t *t)
+{
+	int ret = test_and(t);
+
+	while (!t->err && t->pos < t->argc &&
+	       _strcmp(t->args[t->pos], "-o") == 0)
+	{
+		t->pos++;
+		ret = test_and(t) || ret;
+	}
+	return (ret);
+}
+
+/**
+ * test_and - Parses and evaluates expressions joined by "-a", which binds
+ *            tighter than "-o".
+ * @t: The parser state.
+ *
+ * Return: The truth value of the expression.
+ */
+int test_and(test_t *t)
+{
+	int ret = test_not(t);
+
+	while (!t->err && t->pos < t->argc &&
+	       _strcmp(t->args[t->pos], "-a") == 0)
+	{
+		t->pos++;
+		ret = test_not(t) && ret;
+	}
+	return (ret);
+}
@@ -0,0 +1,169 @@
+#include "shell.h"
+
+int test_not(test_t *t);
+int test_primary(test_t *t);
+int test_binary(test_t *t, char *a, char *op, char *b);
+int test_num(test_t *t, char *s, long *num);
+int test_op(char *s, int binary);
+
+/**
+ * test_not - Parses and evaluates an expression that may be negated
+ *            with "!".
+ * @t: The parser state.
+ *
+ * Return: The truth value of the expression.
+ *
+ * Description: A "!" followed by a binary operator is an operand, so that
+ *              "! = x" compares strings as POSIX requires.
+ */
+int test_not(test_t *t)
+{
+	int left = t->argc - t->pos;
+
+	if (left >= 2 && _strcmp(t->args[t->pos], "!") == 0 &&
+	    !(left >= 3 && test_op(t->args[t->pos + 1], 1)))
+	{
+		t->pos++;
+		return (!test_not(t));
+	}
+	return (test_primary(t));
+}
+
+/**
+ * test_primary - Parses and evaluates a primary: a binary comparison, a
+ *                unary predicate, a parenthesized expression or a string.
+ * @t: The parser state.
+ *
+ * Return: The truth value of the primary.
+ */
+int test_primary(test_t *t)
+{
+	int left = t->argc - t->pos, ret;
+	char **a = t->args + t->pos;
+
+	if (!left)
+	{
+		print_error(ERR_TEST_ARG, "");
+		t->err = 1;
+		return (0);
+	}
+	if (left >= 3 && test_op(a[1], 1))
+	{
+		t->pos += 3;
+		return (test_binary(t, a[0], a[1], a[2]));
+	}
+	if (left >= 2 && _strcmp(a[0], "(") == 0)
+	{
+		t->pos++;
+		ret = test_or(t);
+		if (!t->err && (t->pos >= t->argc ||
+				_strcmp(t->args[t->pos], ")") != 0))
+		{
+			print_error(ERR_TEST_PAREN, "");
+			t->err = 1;
+		}
+		t->pos++;
+		return (ret);
+	}
+	if (left >= 2 && test_op(a[0], 0))
+	{
+		t->pos += 2;
+		return (test_unary(t, a[0][1], a[1]));
+	}
+	t->pos++;
+	return (a[0][0] != '\0');
+}
+
+/**
+ * test_binary - Evaluates a binary comparison.
+ * @t: The parser state, for reporting bad numbers.
+ * @a: The left operand.
+ * @op: The operator.
+ * @b: The right operand.
+ *
+ * Return: The truth value of the comparison.
+ */
+int test_binary(test_t *t, char *a, char *op, char *b)
+{
+	int i = test_op(op, 1) - 1, c;
+	long x, y;
+
+	if (i < 4)
+	{
+		c = _strcmp(a, b);
+		if (i < 2)
+			return (i == 0 ? c == 0 : c != 0);
+		return (i == 2 ? c < 0 : c > 0);
+	}
+	if (i >= 10)
+		return (test_files(a, op, b));
+	if (test_num(t, a, &x) || test_num(t, b, &y))
+		return (0);
+	c = (x > y) - (x < y);
+	if (i == 4 || i == 5)
+		return (i == 4 ? c == 0 : c != 0);
+	if (i == 6 || i == 7)
+		return (i == 6 ? c < 0 : c <= 0);
+	return (i == 8 ? c > 0 : c >= 0);
+}
+
+/**
+ * test_num - Converts an integer operand.
+ * @t: The parser state, marked on error.
+ * @s: The operand. Blanks around the digits are allowed.
+ * @num: Where to store the number.
+ *
+ * Return: 0 on success, or 1 if s is not an integer or does not fit in
+ *         a long.
+ */
+int test_num(test_t *t, char *s, long *num)
+{
+	char *p = s;
+	int neg = 0, any = 0, big = 0;
+	unsigned long u = 0, max;
+
+	while (*p == ' ' || *p == '\t')
+		p++;
+	if (*p == '-' || *p == '+')
+		neg = *p++ == '-';
+	max = neg ? (unsigned long)LONG_MAX + 1 : LONG_MAX;
+	for (; *p >= '0' && *p <= '9'; p++, any = 1)
+	{
+		big |= u > (max - (*p - '0')) / 10;
+		u = u * 10 + (*p - '0');
+	}
+	while (*p == ' ' || *p == '\t')
+		p++;
+	*num = neg ? (long)-u : (long)u;
+	if (any && !big && !*p)
+		return (0);
+	print_error(ERR_TEST_NUM, s);
+	t->err = 1;
+	return (1);
+}
+
+/**
+ * test_op - Recognizes the operators of test.
+ * @s: The word to check.
+ * @binary: Non-zero to check for a binary operator, zero for a unary one.
+ *
+ * Return: For a binary operator - its position in the table plus one.
+ *         For a unary operator - 1.
+ *         Otherwise - 0.
+ */
+int test_op(char *s, int binary)
+{
+	static char *ops[] = { "=", "!=", "<", ">", "-eq", "-ne", "-lt", "-le",
+		"-gt", "-ge", "-nt", "-ot", "-ef", NULL };
+	int i;
+
+	if (!binary)
+		return (s[0] == '-' && s[1] && !s[2] &&
+			_strchr("bcdefghLknprsStuwxzOG", s[1]) != NULL);
+	for (i = 0; ops[i]; i++)
+	{
+		if (_strcmp(s, ops[i]) == 0)
+			return (i + 1);
+	}
+	return (0);
+}
@@ -0,0 +1,193 @@
+#include "shell.h"
+
+void stat_cache_reset(void);
+struct stat *stat_cached(char *path, int follow);
+int test_unary(test_t *t, char op, char *arg);
+int test_access(struct stat *st, int mode);
+int test_files(char *a, char *op, char *b);
+
+static stat_ent_t stat_ents[STAT_CACHE_SLOTS];
+static int stat_used, stat_next;
+static unsigned long stat_gen;
+
+/**
+ * stat_cache_reset - Forgets the paths looked up by test.
+ *
+ * Description: Called for every new line and after every external
+ *              command, since either may have changed the files.
+ */
+void stat_cache_reset(void)
+{
+	stat_used = 0;
+	stat_next = 0;
+}
+
+/**
+ * stat_cached - Looks up a path through the stat cache.
+ * @path: The path.
+ * @follow: Non-zero to follow a final symbolic link.
+ *
+ * Return: If the path does not exist - NULL, with errno set.
+ *         Otherwise - the file's status. It stays valid until the next
+ *         lookup.
+ *
+ * Description: Several tests on the same path cost one fstatat(2). A
+ *              lookup that does not follow links also answers one that
+ *              does when the path is not a link. Changing directory
+ *              empties the cache, since paths may be relative.
+ */
+struct stat *stat_cached(char *path, int follow)
+{
+	static struct stat big;
+	stat_ent_t *e;
+	int i, len = _strlen(path), flags = follow ? 0 : AT_SYMLINK_NOFOLLOW;
+
+	if (stat_gen != path_gen)
+		stat_cache_reset();
+	stat_gen = path_gen;
+	for (i = 0; i < stat_used; i++)
+	{
+		e = &stat_ents[i];
+		if (_strcmp(e->path, path) != 0)
+			continue;
+		if (e->follow == follow || (follow && (e->err == ENOENT ||
+		    (!e->err && !S_ISLNK(e->st.st_mode)))))
+		{
+			errno = e->err;
+			return (e->err ? NULL : &e->st);
+		}
+	}
+	if (len >= STAT_PATH_MAX)
+	{
+		i = fstatat(AT_FDCWD, path, &big, flags);
+		return (i == 0 ? &big : NULL);
+	}
+	e = &stat_ents[stat_next];
+	stat_next = (stat_next + 1) % STAT_CACHE_SLOTS;
+	if (stat_used < STAT_CACHE_SLOTS)
+		stat_used++;
+	_memcpy(e->path, path, len + 1);
+	e->follow = follow;
+	e->err = fstatat(AT_FDCWD, path, &e->st, flags) == -1 ? errno : 0;
+	errno = e->err;
+	return (e->err ? NULL : &e->st);
+}
+
+/**
+ * test_unary - Evaluates a unary predicate.
+ * @t: The parser state, for reporting bad numbers.
+ * @op: The operator letter.
+ * @arg: The operand.
+ *
+ * Return: The truth value of the predicate.
+ */
+int test_unary(test_t *t, char op, char *arg)
+{
+	struct stat *st;
+	long fd;
+
+	if (op == 'n' || op == 'z')
+		return ((arg[0] != '\0') == (op == 'n'));
+	if (op == 't')
+		return (test_num(t, arg, &fd) == 0 && isatty(fd));
+	st = stat_cached(arg, op != 'h' && op != 'L');
+	if (!st)
+		return (0);
+	if (op == 'r' || op == 'w' || op == 'x')
+		return (test_access(st, op == 'r' ? 4 : op == 'w' ? 2 : 1));
+	switch (op)
+	{
+	case 'b':
+		return (S_ISBLK(st->st_mode));
+	case 'c':
+		return (S_ISCHR(st->st_mode));
+	case 'd':
+		return (S_ISDIR(st->st_mode));
+	case 'f':
+		return (S_ISREG(st->st_mode));
+	case 'p':
+		return (S_ISFIFO(st->st_mode));
+	case 'S':
+		return (S_ISSOCK(st->st_mode));
+	case 'h':
+	case 'L':
+		return (S_ISLNK(st->st_mode));
+	case 's':
+		return (st->st_size > 0);
+	case 'O':
+		return (st->st_uid == geteuid());
+	case 'G':
+		return (st->st_gid == getegid());
+	}
+	return (op == 'e' || (st->st_mode & (op == 'g' ? S_ISGID :
+					     op == 'u' ? S_ISUID : S_ISVTX)));
+}
+
+/**
+ * test_access - Checks a file's permission bits against the shell's
+ *               effective credentials.
+ * @st: The file's status.
+ * @mode: 4 for read, 2 for write or 1 for execute.
+ *
+ * Return: Non-zero if access is allowed.
+ *
+ * Description: Works from the cached status instead of another
+ *              syscall. Root may read and write anything and execute
+ *              anything with an execute bit set, or any directory.
+ */
+int test_access(struct stat *st, int mode)
+{
+	static gid_t groups[64];
+	static int ngroups = -1;
+	int i, shift = 0;
+
+	if (ngroups == -1)
+		ngroups = getgroups(64, groups);
+	if (geteuid() == 0)
+		return (mode != 1 || (st->st_mode & 0111) ||
+			S_ISDIR(st->st_mode));
+	if (st->st_uid == geteuid())
+		shift = 6;
+	else if (st->st_gid == getegid())
+		shift = 3;
+	for (i = 0; !shift && i < ngroups; i++)
+	{
+		if (groups[i] == st->st_gid)
+			shift = 3;
+	}
+	return (((st->st_mode >> shift) & mode) != 0);
+}
+
+/**
+ * test_files - Compares two files.
+ * @a: The left file.
+ * @op: "-nt" (newer than), "-ot" (older than) or "-ef" (same file).
+ * @b: The right file.
+ *
+ * Return: The truth value of the comparison. A missing file is older
+ *         than any existing one and the same as none.
+ */
+int test_files(char *a, char *op, char *b)
+{
+	struct stat sa, *pb;
+	int has_a = 0, c;
+
+	pb = stat_cached(a, 1);
+	if (pb)
+	{
+		sa = *pb;
+		has_a = 1;
+	}
+	pb = stat_cached(b, 1);
+	if (op[1] == 'e')
+		return (has_a && pb && sa.st_dev == pb->st_dev &&
+			sa.st_ino == pb->st_ino);
+	if (!has_a || !pb)
+		return (op[1] == 'n' ? has_a : pb != NULL);
+	c = (sa.st_mtim.tv_sec > pb->st_mtim.tv_sec) -
+		(sa.st_mtim.tv_sec < pb->st_mtim.tv_sec);
+	if (!c)
+		c = (sa.st_mtim.tv_nsec > pb->st_mtim.tv_nsec) -
+			(sa.st_mtim.tv_nsec < pb->st_mtim.tv_nsec);
+	return (op[1] == 'n' ? c > 0 : c < 0);
+}
@@ -0,0 +1,40 @@
+#!/bin/sh
+# Syntax regression tests. Runs each case through the shell given as the
+# argument, ./hsh by default, and compares its output and exit status.
+# Prints the failing cases and exits non-zero if there are any.
+
+sh=${1:-./hsh}
+fail=0
+
+# check CODE EXPECTED - Runs CODE and compares its output, errors
+# included, followed by its exit status, against EXPECTED.
+check()
+{
+	got=$(printf '%s\n' "$1" | "$sh" 2>&1; echo "status $?")
+	got=$(printf '%s\n' "$got" | sed 's/^[^:]*: [0-9]*: //')
+	if [ "$got" != "$2" ]
+	then
+		printf 'FAIL: %s\n  expected: %s\n  got:      %s\n' "$1" "$2" "$got"
+		fail=1
+	fi
+}
+
+nl='
+'
+
+# Arithmetic expansion closes with "))", and nothing after it.
+check 'echo $((2*(3+4)))' "14${nl}status 0"
+check 'echo $(( $((1)) + 1 ))' "2${nl}status 0"
+check 'echo $(()))' "Syntax error: \")\" unexpected${nl}status 2"
+check 'echo $((1)+(2))' "Syntax error: Missing '))'${nl}status 2"
+
+# Parentheses outside $(...) are words for test and [, and operators only
+# in case patterns and function definitions.
+check 'test ( 1 -eq 1 ) && echo paren' "paren${nl}status 0"
+check '[ ( 1 -eq 2 -o 1 -eq 1 ) ] && echo paren' "paren${nl}status 0"
+check '[ ! ( 1 -eq 1 ) ] || echo not' "not${nl}status 0"
+check 'f() { echo func; }; f' "func${nl}status 0"
+check 'case a in (a) echo pattern;; esac' "pattern${nl}status 0"
+
+[ $fail -eq 0 ] && echo "syntax tests passed"
+exit $fail
@@ -0,0 +1,95 @@
+#include "shell.h"
+
+int timing_start(char **args, timing_t *t);
+void timing_child(struct rusage *ru);
+void timing_end(timing_t *t, char **args, int status, int is_builtin);
+long tv_us(struct timeval *tv);
+
+static struct rusage child_ru;
+static int child_ru_set;
+
+/**
+ * timing_start - Decides whether a command is measured and starts the
+ *                measurement.
+ * @args: The arguments of the command, including a leading "time".
+ * @t: The measurement to start.
+ *
+ * Return: If the command is not measured - 0.
+ *         Otherwise - 1.
+ *
+ * Description: A command is measured when it is prefixed with "time", or
+ *              when HSH_RUSAGE_LOG names a file that records every
+ *              command. A measured command is never run in place of the
+ *              shell, since its usage could not be reported.
+ */
+int timing_start(char **args, timing_t *t)
+{
+	char **log = _getenv("HSH_RUSAGE_LOG");
+
+	t->print = (_strcmp(args[0], "time") == 0 && args[1]);
+	t->log = (log && (*log)[15]) ? *log + 15 : NULL;
+	if (!t->print && !t->log)
+		return (0);
+	tail_exec = 0;
+	child_ru_set = 0;
+	getrusage(RUSAGE_SELF, &t->self);
+	clock_gettime(CLOCK_MONOTONIC, &t->start);
+	return (1);
+}
+
+/**
+ * timing_child - Records the usage of a child that has been waited for.
+ * @ru: The usage returned by wait4(2).
+ */
+void timing_child(struct rusage *ru)
+{
+	child_ru = *ru;
+	child_ru_set = 1;
+}
+
+/**
+ * timing_end - Completes a measurement and reports it.
+ * @t: The measurement started by timing_start.
+ * @args: The arguments of the command, without the "time" prefix.
+ * @status: The exit status of the command.
+ * @is_builtin: Non-zero if the command ran inside the shell.
+ *
+ * Description: A child reports the usage returned by wait4(2). A builtin
+ *              reports the growth of the shell's own usage while it ran.
+ */
+void timing_end(timing_t *t, char **args, int status, int is_builtin)
+{
+	struct timespec end;
+	struct rusage now;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	t->real_us = (end.tv_sec - t->start.tv_sec) * 1000000L +
+		(end.tv_nsec - t->start.tv_nsec) / 1000;
+	if (is_builtin || !child_ru_set)
+	{
+		getrusage(RUSAGE_SELF, &now);
+		now.ru_utime.tv_sec -= t->self.ru_utime.tv_sec;
+		now.ru_utime.tv_usec -= t->self.ru_utime.tv_usec;
+		now.ru_stime.tv_sec -= t->self.ru_stime.tv_sec;
+		now.ru_stime.tv_usec -= t->self.ru_stime.tv_usec;
+		now.ru_nvcsw -= t->self.ru_nvcsw;
+		now.ru_nivcsw -= t->self.ru_nivcsw;
+		now.ru_minflt -= t->self.ru_minflt;
+		now.ru_majflt -= t->self.ru_majflt;
+		t->self = now;
+	}
+	else
+		t->self = child_ru;
+	timing_report(t, args, status, is_builtin);
+}
+
+/**
+ * tv_us - Converts a timeval to microseconds.
+ * @tv: The timeval.
+ *
+ * Return: The number of microseconds.
+ */
+long tv_us(struct timeval *tv)
+{
+	return (tv->tv_sec * 1000000L + tv->tv_usec);
+}
@@ -0,0 +1,111 @@
+#include "shell.h"
+
+size_t json_str(char *buf, size_t room, char **args);
+size_t json_num(char *buf, char *key, long num);
+void timing_report(timing_t *t, char **args, int status, int is_builtin);
+
+/**
+ * json_str - Writes the words of a command as an escaped JSON string.
+ * @buf: The buffer to write to.
+ * @room: The number of bytes available in buf, at least 8.
+ * @args: The words of the command.
+ *
+ * Return: The number of bytes written.
+ *
+ * Description: A command too long for the buffer is cut short; the
+ *              string is always closed.
+ */
+size_t json_str(char *buf, size_t room, char **args)
+{
+	static const char hex[] = "0123456789abcdef";
+	size_t len = 0, i;
+	unsigned char c;
+	char *s;
+
+	buf[len++] = '"';
+	for (i = 0; args[i] && len + 8 < room; i++)
+	{
+		if (i)
+			buf[len++] = ' ';
+		for (s = args[i]; *s && len + 8 < room; s++)
+		{
+			c = (unsigned char)*s;
+			if (c == '"' || c == '\\')
+				buf[len++] = '\\';
+			if (c >= 0x20)
+			{
+				buf[len++] = c;
+				continue;
+			}
+			_memcpy(buf + len, "\\u00", 4);
+			buf[len + 4] = hex[c >> 4];
+			buf[len + 5] = hex[c & 0xf];
+			len += 6;
+		}
+	}
+	buf[len++] = '"';
+	return (len);
+}
+
+/**
+ * json_num - Writes a JSON member with a number value.
+ * @buf: The buffer to write to, with room for at least 48 bytes.
+ * @key: The key, including its quotes, colon and leading comma.
+ * @num: The value.
+ *
+ * Return: The number of bytes written.
+ */
+size_t json_num(char *buf, char *key, long num)
+{
+	size_t len = _strlen(key);
+
+	_memcpy(buf, key, len);
+	return (len + _itoa_buf(num, buf + len));
+}
+
+/**
+ * timing_report - Reports a measured command as a JSON line.
+ * @t: The completed measurement.
+ * @args: The words of the command.
+ * @status: The exit status of the command.
+ * @is_builtin: Non-zero if the command ran inside the shell.
+ *
+ * Description: "time" prints the line to standard error. HSH_RUSAGE_LOG
+ *              appends it to the named file with a single write, so lines
+ *              from concurrent shells do not interleave.
+ */
+void timing_report(timing_t *t, char **args, int status, int is_builtin)
+{
+	char buf[1024];
+	size_t len = 0;
+	int fd;
+
+	_memcpy(buf, "{\"cmd\":", 7);
+	len = 7 + json_str(buf + 7, 512, args);
+	len += json_num(buf + len, ",\"status\":", status);
+	len += json_num(buf + len, ",\"builtin\":", is_builtin != 0);
+	len += json_num(buf + len, ",\"real_us\":", t->real_us);
+	len += json_num(buf + len, ",\"user_us\":", tv_us(&t->self.ru_utime));
+	len += json_num(buf + len, ",\"sys_us\":", tv_us(&t->self.ru_stime));
+	len += json_num(buf + len, ",\"maxrss_kb\":", t->self.ru_maxrss);
+	len += json_num(buf + len, ",\"minflt\":", t->self.ru_minflt);
+	len += json_num(buf + len, ",\"majflt\":", t->self.ru_majflt);
+	len += json_num(buf + len, ",\"nvcsw\":", t->self.ru_nvcsw);
+	len += json_num(buf + len, ",\"nivcsw\":", t->self.ru_nivcsw);
+	_memcpy(buf + len, "}\n", 2);
+	len += 2;
+	if (t->print)
+	{
+		out_flush();
+		write(STDERR_FILENO, buf, len);
+	}
+	if (t->log)
+	{
+		fd = open(t->log, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
+			  0644);
+		if (fd == -1)
+			return;
+		write(fd, buf, len);
+		close(fd);
+	}
+}
@@ -0,0 +1,168 @@
+#include "shell.h"
+
+int uring_setup(uring_t *u);
+uring_t *uring_get(void);
+int uring_queue(uring_t *u, struct io_uring_sqe *op, int id);
+int uring_wait(uring_t *u, int id);
+void uring_close(void);
+
+static uring_t ring;
+static int ring_tried;
+
+/**
+ * uring_setup - Creates an io_uring instance and maps its rings.
+ * @u: The ring to set up.
+ *
+ * Return: If the kernel or the sandbox refuses io_uring - -1.
+ *         Otherwise - 0.
+ */
+int uring_setup(uring_t *u)
+{
+	struct io_uring_params p;
+	char *sq, *cq;
+
+	_memset(&p, 0, sizeof(p));
+	u->fd = syscall(SYS_io_uring_setup, URING_ENTRIES, &p);
+	if (u->fd < 0)
+		return (-1);
+	u->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	u->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if ((p.features & IORING_FEAT_SINGLE_MMAP) && u->cq_size > u->sq_size)
+		u->sq_size = u->cq_size;
+	u->sqe_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	u->sq_map = mmap(NULL, u->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED |
+			 MAP_POPULATE, u->fd, IORING_OFF_SQ_RING);
+	u->cq_map = (p.features & IORING_FEAT_SINGLE_MMAP) ? u->sq_map :
+		mmap(NULL, u->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED |
+		     MAP_POPULATE, u->fd, IORING_OFF_CQ_RING);
+	u->sqes = mmap(NULL, u->sqe_size, PROT_READ | PROT_WRITE, MAP_SHARED |
+		       MAP_POPULATE, u->fd, IORING_OFF_SQES);
+	if (u->sq_map == MAP_FAILED || u->cq_map == MAP_FAILED ||
+	    u->sqes == MAP_FAILED)
+		return (-1);
+	sq = u->sq_map;
+	cq = u->cq_map;
+	u->sq_head = (unsigned int *)(sq + p.sq_off.head);
+	u->sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+	u->sq_mask = *(unsigned int *)(sq + p.sq_off.ring_mask);
+	u->sq_array = (unsigned int *)(sq + p.sq_off.array);
+	u->cq_head = (unsigned int *)(cq + p.cq_off.head);
+	u->cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+	u->cq_mask = *(unsigned int *)(cq + p.cq_off.ring_mask);
+	u->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+	u->entries = p.sq_entries;
+	u->pid = getpid();
+	return (0);
+}
+
+/**
+ * uring_get - Gets the io_uring backend, setting it up on first use.
+ *
+ * Return: If HSH_IO_URING is unset or io_uring is unavailable - NULL.
+ *         Otherwise - the ring.
+ *
+ * Description: A forked child shares the rings with the shell and could
+ *              reap its completions, leaving the shell waiting forever.
+ *              The child lets go of the ring on first use instead, and
+ *              falls back to plain system calls.
+ */
+uring_t *uring_get(void)
+{
+	char **var;
+
+	if (ring_tried && ring.fd >= 0 && ring.pid != getpid())
+		uring_close();
+	if (ring_tried)
+		return (ring.fd >= 0 ? &ring : NULL);
+	ring_tried = 1;
+	ring.fd = -1;
+	var = _getenv("HSH_IO_URING");
+	if (!var || (*var)[12] != '=' || !(*var)[13])
+		return (NULL);
+	if (uring_setup(&ring) == 0)
+		return (&ring);
+	uring_close();
+	return (NULL);
+}
+
+/**
+ * uring_queue - Queues an operation without submitting it.
+ * @u: The ring.
+ * @op: The operation. Its user_data is replaced by id.
+ * @id: The identifier the completion is waited for by, below URING_IDS.
+ *
+ * Return: If the submission queue is full - -1.
+ *         Otherwise - 0.
+ */
+int uring_queue(uring_t *u, struct io_uring_sqe *op, int id)
+{
+	unsigned int tail = *u->sq_tail, idx;
+
+	if (tail - __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE) >= u->entries)
+		return (-1);
+	idx = tail & u->sq_mask;
+	u->sqes[idx] = *op;
+	u->sqes[idx].user_data = id;
+	u->sq_array[idx] = idx;
+	u->done[id] = 0;
+	__atomic_store_n(u->sq_tail, tail + 1, __ATOMIC_RELEASE);
+	u->queued++;
+	return (0);
+}
+
+/**
+ * uring_wait - Submits the queued operations and waits for one of them.
+ * @u: The ring.
+ * @id: The identifier of the operation to wait for, or -1 to only submit.
+ *
+ * Return: The result of the operation, as returned by the equivalent
+ *         system call but with -errno on failure.
+ *
+ * Description: Completions of other operations are kept for their own
+ *              uring_wait.
+ */
+int uring_wait(uring_t *u, int id)
+{
+	unsigned int head;
+	struct io_uring_cqe *cqe;
+	int ret, need = (id >= 0 && !u->done[id]);
+
+	while (u->queued || need)
+	{
+		ret = syscall(SYS_io_uring_enter, u->fd, u->queued, need,
+			      need ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+		if (ret < 0 && errno != EINTR)
+			return (-errno);
+		u->queued -= ret > 0 ? (unsigned int)ret : 0;
+		head = *u->cq_head;
+		while (head != __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE))
+		{
+			cqe = &u->cqes[head++ & u->cq_mask];
+			u->res[cqe->user_data] = cqe->res;
+			u->done[cqe->user_data] = 1;
+		}
+		__atomic_store_n(u->cq_head, head, __ATOMIC_RELEASE);
+		need = (id >= 0 && !u->done[id]);
+	}
+	return (id >= 0 ? u->res[id] : 0);
+}
+
+/**
+ * uring_close - Unmaps the rings and closes the io_uring instance.
+ */
+void uring_close(void)
+{
+	if (!ring_tried)
+		return;
+	if (ring.sqes && ring.sqes != MAP_FAILED)
+		munmap(ring.sqes, ring.sqe_size);
+	if (ring.cq_map && ring.cq_map != MAP_FAILED &&
+	    ring.cq_map != ring.sq_map)
+		munmap(ring.cq_map, ring.cq_size);
+	if (ring.sq_map && ring.sq_map != MAP_FAILED)
+		munmap(ring.sq_map, ring.sq_size);
+	if (ring.fd >= 0)
+		close(ring.fd);
+	_memset(&ring, 0, sizeof(ring));
+	ring.fd = -1;
+}
@@ -0,0 +1,152 @@
+#include "shell.h"
+
+ssize_t uring_writev(int fd, struct iovec *iov, int cnt);
+ssize_t uring_read_all(int fd, char *buf, size_t size);
+int uring_read_ahead(int fd, char *buf, size_t len, off_t off);
+ssize_t uring_read_done(void);
+
+static int ahead_fd;
+static struct iovec ahead;
+static off_t ahead_off;
+
+/**
+ * uring_writev - Writes a scatter list through io_uring when enabled.
+ * @fd: The file descriptor to write to.
+ * @iov: The scatter list.
+ * @cnt: The number of entries in iov.
+ *
+ * Return: The result of writev(2).
+ *
+ * Description: The whole list goes out as a single IORING_OP_WRITEV at the
+ *              current file position. Without io_uring, writev(2) is
+ *              called directly.
+ */
+ssize_t uring_writev(int fd, struct iovec *iov, int cnt)
+{
+	uring_t *u = uring_get();
+	struct io_uring_sqe op;
+	int ret;
+
+	if (!u)
+		return (writev(fd, iov, cnt));
+	_memset(&op, 0, sizeof(op));
+	op.opcode = IORING_OP_WRITEV;
+	op.fd = fd;
+	op.addr = (unsigned long)iov;
+	op.len = cnt;
+	op.off = -1;
+	if (uring_queue(u, &op, URING_ID_WRITE) == -1)
+		return (writev(fd, iov, cnt));
+	ret = uring_wait(u, URING_ID_WRITE);
+	if (ret >= 0)
+		return (ret);
+	errno = -ret;
+	return (-1);
+}
+
+/**
+ * uring_read_all - Reads the start of a file with one batch of reads.
+ * @fd: The file descriptor, positioned at offset 0.
+ * @buf: The buffer to read into.
+ * @size: The number of bytes to read.
+ *
+ * Return: If io_uring is unavailable - 0.
+ *         Otherwise - the number of bytes read contiguously from offset 0.
+ *         The file position is left after them.
+ *
+ * Description: One read per URING_BLOCK bytes is queued, and up to
+ *              URING_BATCH of them are submitted with a single system call.
+ */
+ssize_t uring_read_all(int fd, char *buf, size_t size)
+{
+	uring_t *u = uring_get();
+	struct io_uring_sqe op;
+	size_t done = 0, off, want[URING_BATCH];
+	int i, n = 1, ret, short_read = 0;
+
+	if (!u)
+		return (0);
+	_memset(&op, 0, sizeof(op));
+	op.opcode = IORING_OP_READ;
+	op.fd = fd;
+	while (done < size && !short_read && n)
+	{
+		for (n = 0, off = done; n < URING_BATCH && off < size; n++)
+		{
+			want[n] = size - off;
+			if (want[n] > URING_BLOCK)
+				want[n] = URING_BLOCK;
+			op.addr = (unsigned long)(buf + off);
+			op.len = want[n];
+			op.off = off;
+			if (uring_queue(u, &op, n) == -1)
+				break;
+			off += want[n];
+		}
+		for (i = 0; i < n; i++)
+		{
+			ret = uring_wait(u, i);
+			if (!short_read && ret > 0)
+				done += ret;
+			if (ret < 0 || (size_t)ret != want[i])
+				short_read = 1;
+		}
+	}
+	lseek(fd, done, SEEK_SET);
+	return (done);
+}
+
+/**
+ * uring_read_ahead - Starts reading the next block of a file in the
+ *                    background.
+ * @fd: The file descriptor.
+ * @buf: The buffer to read into. It must not be touched until
+ *       uring_read_done returns.
+ * @len: The number of bytes to read.
+ * @off: The file offset to read from. The file position is not moved.
+ *
+ * Return: If io_uring is unavailable - -1.
+ *         Otherwise - 0.
+ */
+int uring_read_ahead(int fd, char *buf, size_t len, off_t off)
+{
+	uring_t *u = uring_get();
+	struct io_uring_sqe op;
+
+	if (!u)
+		return (-1);
+	ahead_fd = fd;
+	ahead.iov_base = buf;
+	ahead.iov_len = len;
+	ahead_off = off;
+	_memset(&op, 0, sizeof(op));
+	op.opcode = IORING_OP_READ;
+	op.fd = fd;
+	op.addr = (unsigned long)buf;
+	op.len = len;
+	op.off = off;
+	if (uring_queue(u, &op, URING_ID_AHEAD) == -1)
+		return (-1);
+	uring_wait(u, -1);
+	return (0);
+}
+
+/**
+ * uring_read_done - Waits for the read started by uring_read_ahead.
+ *
+ * Return: The result of the read, or -1 on failure.
+ *
+ * Description: In a forked child the read belongs to the shell's ring,
+ *              and is done again with pread(2).
+ */
+ssize_t uring_read_done(void)
+{
+	uring_t *u = uring_get();
+	int ret;
+
+	if (!u)
+		return (pread(ahead_fd, ahead.iov_base, ahead.iov_len,
+			      ahead_off));
+	ret = uring_wait(u, URING_ID_AHEAD);
+	return (ret < 0 ? -1 : ret);
+}
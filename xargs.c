@@ -0,0 +1,173 @@
+#include "shell.h"
+
+int shellby_xargs(char **args, char __attribute__((__unused__)) **front);
+int xargs_opts(xargs_t *x, char **args);
+size_t xargs_read(xargs_t *x);
+int xargs_batch(xargs_t *x, char **argv, size_t *pos);
+
+/**
+ * shellby_xargs - Runs a command over the items read from standard input.
+ * @args: An array of arguments: options, then the command and its
+ *        initial arguments.
+ * @front: A double pointer to the beginning of args.
+ *
+ * Return: If an option is invalid - 2.
+ *         If the command cannot be found or run - 127 or 126.
+ *         If a run failed - 123, or 124 and 125 when one exited with 255
+ *         or was killed, which stops xargs.
+ *         Otherwise - 0.
+ *
+ * Description: The command is looked up once. Its runs are forked from
+ *              the shell with as many items as fit in ARG_MAX, with a
+ *              single vector that every batch reuses.
+ */
+int shellby_xargs(char **args, char __attribute__((__unused__)) **front)
+{
+	xargs_t x;
+	char **argv = NULL;
+	size_t pos = 0;
+	int n = 0;
+
+	_memset(&x, 0, sizeof(x));
+	if (xargs_opts(&x, args) == -1)
+		return (2);
+	if (xargs_read(&x) && xargs_find(&x) == 0)
+		argv = malloc(sizeof(char *) * (x.ncmd + x.count + 1));
+	if (argv)
+		_memcpy(argv, x.cmd, sizeof(char *) * x.ncmd);
+	while (argv && x.status < 124 && (n = xargs_batch(&x, argv, &pos)) > 0)
+		xargs_spawn(&x, argv);
+	while (x.running)
+		xargs_wait(&x);
+	if (argv)
+		sig_read();
+	stat_cache_reset();
+	if (n == -1 && x.status < 123)
+		x.status = 1;
+	if (x.resolved)
+		free(x.path);
+	free(argv);
+	free(x.in.buf);
+	return (x.status);
+}
+
+/**
+ * xargs_opts - Parses the options of xargs.
+ * @x: The run to set up.
+ * @args: The arguments of xargs.
+ *
+ * Return: 0 on success, or -1 if an option is invalid.
+ */
+int xargs_opts(xargs_t *x, char **args)
+{
+	static char *echo[] = { "echo", NULL };
+	char opt, *val;
+	long n;
+	int i;
+
+	x->procs = 1;
+	for (i = 0; args[i] && args[i][0] == '-' && args[i][1]; i++)
+	{
+		if (_strcmp(args[i], "--") == 0)
+		{
+			i++;
+			break;
+		}
+		if (_strcmp(args[i], "-0") == 0)
+		{
+			x->nul = 1;
+			continue;
+		}
+		opt = args[i][1];
+		val = args[i][2] ? args[i] + 2 : args[++i];
+		if ((opt != 'n' && opt != 'P') || !val ||
+		    limit_num(val, 1, 0, &n) == -1)
+		{
+			print_error(ERR_XARGS, val ? val : args[i - 1]);
+			return (-1);
+		}
+		n = n < 1000000 ? n : 1000000;
+		*(opt == 'n' ? &x->max : &x->procs) = n;
+	}
+	x->cmd = args[i] ? args + i : echo;
+	for (x->ncmd = 0; x->cmd[x->ncmd]; x->ncmd++)
+		;
+	return (0);
+}
+
+/**
+ * xargs_read - Reads the items of xargs from its standard input.
+ * @x: The run.
+ *
+ * Return: The number of items.
+ *
+ * Description: The input is kept in one buffer and split in place, so
+ *              items take no allocation of their own.
+ */
+size_t xargs_read(xargs_t *x)
+{
+	char buf[XARGS_READ], *s;
+	int fd = cmd_stdin > 0 ? cmd_stdin : STDIN_FILENO, item = 0;
+	ssize_t n;
+	size_t i;
+
+	while ((n = read(fd, buf, XARGS_READ)) != 0)
+	{
+		if (n == -1 && errno != EINTR)
+			break;
+		if (n > 0)
+			cmdsub_add(&x->in, buf, n);
+	}
+	s = x->in.buf;
+	for (i = 0; s && i < x->in.len; i++)
+	{
+		if (!x->nul && (s[i] == ' ' || s[i] == '\t' || s[i] == '\n'))
+			s[i] = '\0';
+		x->count += s[i] && !item;
+		item = s[i] != '\0';
+	}
+	if (s)
+		s[x->in.len] = '\0';
+	return (x->count);
+}
+
+/**
+ * xargs_batch - Fills the vector of the next run with items.
+ * @x: The run.
+ * @argv: The vector, holding the command and its initial arguments.
+ * @pos: The offset of the next item in the input.
+ *
+ * Return: The number of items added, 0 once they have all been run, or
+ *         -1 if one is too long to be passed at all.
+ */
+int xargs_batch(xargs_t *x, char **argv, size_t *pos)
+{
+	size_t size = 0, len;
+	int n = x->ncmd;
+	char *s;
+
+	while (*pos < x->in.len && (!x->max || n - x->ncmd < x->max))
+	{
+		s = x->in.buf + *pos;
+		len = _strlen(s);
+		if (!len)
+		{
+			(*pos)++;
+			continue;
+		}
+		if (size + len + 1 + sizeof(char *) > x->room &&
+		    n > x->ncmd && len < ARG_STRLEN_MAX)
+			break;
+		if (size + len + 1 + sizeof(char *) > x->room ||
+		    len >= ARG_STRLEN_MAX)
+		{
+			print_error(ERR_ARG_MAX, x->cmd[0]);
+			return (-1);
+		}
+		size += len + 1 + sizeof(char *);
+		argv[n++] = s;
+		*pos += len + 1;
+	}
+	argv[n] = NULL;
+	return (n - x->ncmd);
+}
@@ -0,0 +1,141 @@
+#include "shell.h"
+
+int xargs_find(xargs_t *x);
+void xargs_spawn(xargs_t *x, char **argv);
+void xargs_child(xargs_t *x, char **argv);
+void xargs_wait(xargs_t *x);
+
+/**
+ * xargs_find - Looks up the command of xargs once for all its runs.
+ * @x: The run.
+ *
+ * Return: 0 on success, or -1 if the command cannot be found, after
+ *         setting x->status and printing an error.
+ *
+ * Description: The lookup leaves the command's descriptor in the PATH
+ *              cache, where every run execs it from. The signal mask the
+ *              runs need is worked out here too, so they only have to set
+ *              it.
+ */
+int xargs_find(xargs_t *x)
+{
+	size_t used = argv_size(x->cmd);
+
+	x->path = x->cmd[0];
+	if (x->path[0] != '/' && x->path[0] != '.')
+	{
+		x->resolved = 1;
+		x->path = get_location(x->cmd[0]);
+	}
+	if (!x->path || (!x->resolved && access(x->path, F_OK) == -1))
+	{
+		x->status = create_error(x->cmd, errno == EACCES ? 126 : 127);
+		return (-1);
+	}
+	x->room = argv_limit();
+	x->room = x->room > used ? x->room - used : 0;
+	sigprocmask(SIG_SETMASK, NULL, &x->mask);
+	if (sig_fd_get() != -1)
+	{
+		sigdelset(&x->mask, SIGINT);
+		sigdelset(&x->mask, SIGCHLD);
+		sigdelset(&x->mask, SIGWINCH);
+	}
+	return (0);
+}
+
+/**
+ * xargs_spawn - Starts a run of the command of xargs.
+ * @x: The run.
+ * @argv: The command and its arguments.
+ *
+ * Description: Once x->procs runs are going, one is waited for first.
+ *              Runs read nothing: their standard input is /dev/null, as
+ *              xargs owns its own. They are started with vfork, which
+ *              spares copying the shell's page tables for every run.
+ */
+void xargs_spawn(xargs_t *x, char **argv)
+{
+	pid_t pid;
+	int in = cmd_stdin;
+
+	if (x->running >= x->procs)
+		xargs_wait(x);
+	out_flush();
+	cmd_stdin = 0;
+	pid = vfork();
+	if (pid == 0)
+		xargs_child(x, argv);
+	cmd_stdin = in;
+	if (pid == -1)
+	{
+		perror("Error child:");
+		x->status = 125;
+		return;
+	}
+	x->running++;
+}
+
+/**
+ * xargs_child - Runs the command of xargs in a vfork'd child.
+ * @x: The run.
+ * @argv: The command and its arguments.
+ *
+ * Description: The child shares the shell's memory until it execs, so it
+ *              keeps to its own stack frame and system calls. A failure
+ *              is reported with a fixed message written straight to
+ *              stderr, bypassing the shell's buffers.
+ */
+void xargs_child(xargs_t *x, char **argv)
+{
+	struct iovec iov[4];
+	int fd, denied;
+
+	sigprocmask(SIG_SETMASK, &x->mask, NULL);
+	fd = open("/dev/null", O_RDONLY);
+	if (fd > 0)
+	{
+		dup2(fd, STDIN_FILENO);
+		close(fd);
+	}
+	path_execve(x->path, argv, x->resolved);
+	denied = errno == EACCES;
+	iov[0].iov_base = name;
+	iov[0].iov_len = _strlen(name);
+	iov[1].iov_base = ": xargs: ";
+	iov[1].iov_len = 9;
+	iov[2].iov_base = argv[0];
+	iov[2].iov_len = _strlen(argv[0]);
+	iov[3].iov_base = denied ? ": Permission denied\n" : ": not found\n";
+	iov[3].iov_len = _strlen(iov[3].iov_base);
+	writev(STDERR_FILENO, iov, 4);
+	_exit(denied ? 126 : 127);
+}
+
+/**
+ * xargs_wait - Waits for a run of the command of xargs to finish.
+ * @x: The run. Its status becomes the worst seen so far.
+ */
+void xargs_wait(xargs_t *x)
+{
+	struct rusage ru;
+	int status = 0, code;
+
+	while (wait4(-1, &status, 0, &ru) == -1)
+	{
+		if (errno != EINTR)
+		{
+			x->running = 0;
+			return;
+		}
+	}
+	x->running--;
+	timing_child(&ru);
+	code = WIFSIGNALED(status) ? 125 : WEXITSTATUS(status);
+	if (code == 255)
+		code = 124;
+	else if (code && code < 125)
+		code = 123;
+	if (code > x->status)
+		x->status = code;
+}